@@ -0,0 +1,194 @@
+/*!
+ * @file bench_util.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Helpers shared by the sc_map benchmarks.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstddef>
+
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+//******************************************************************************
+
+/*!
+ * @brief Wall clock stopwatch with nanosecond resolution.
+ */
+class bench_timer
+{
+public:
+    typedef std::chrono::steady_clock clock_type;
+
+    bench_timer() :
+            start_time(clock_type::now())
+    {}
+
+    void restart()
+    {
+        start_time = clock_type::now();
+
+        return;
+    }
+
+    double elapsed_ns() const
+    {
+        return std::chrono::duration<double, std::nano>(clock_type::now() - start_time).count();
+    }
+
+private:
+    clock_type::time_point start_time;
+};
+
+//******************************************************************************
+
+/*!
+ * @brief Result of one benchmark case.
+ *
+ * element_cnt is the actual number of elements of the container, which can
+ * differ from the requested size, e.g. for square containers. operation_cnt
+ * is the number of elements or operations the time is divided by.
+ */
+struct bench_result
+{
+    std::size_t element_cnt;
+    std::size_t operation_cnt;
+    double total_ns;
+    double allocations;
+
+    bench_result() :
+            element_cnt(0),
+            operation_cnt(0),
+            total_ns(0.0),
+            allocations(-1.0)
+    {}
+};
+
+typedef bench_result (*bench_case_type)(const std::size_t size);
+
+//******************************************************************************
+inline std::size_t bench_peak_rss_kb()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    return static_cast<std::size_t>(usage.ru_maxrss);
+}
+
+//******************************************************************************
+inline void bench_print_header(const char* unit)
+{
+    std::cout << std::left << std::setw(24) << "case"
+              << std::right << std::setw(12) << "elements"
+              << std::setw(14) << "total [ms]"
+              << std::setw(18) << (std::string("[ns/") + unit + "]")
+              << std::setw(20) << (std::string("[allocs/") + unit + "]")
+              << std::setw(16) << "peak RSS [MB]" << std::endl;
+
+    return;
+}
+
+//******************************************************************************
+inline void bench_print_result(const char* case_name, const bench_result& result)
+{
+    const double operation_cnt = (result.operation_cnt > 0) ? result.operation_cnt : 1;
+
+    std::cout << std::left << std::setw(24) << case_name
+              << std::right << std::setw(12) << result.element_cnt
+              << std::fixed << std::setprecision(3)
+              << std::setw(14) << result.total_ns / 1e6
+              << std::setw(18) << result.total_ns / operation_cnt;
+    if (result.allocations >= 0.0)
+    {
+        std::cout << std::setw(20) << result.allocations / operation_cnt;
+    }
+    else
+    {
+        std::cout << std::setw(20) << "-";
+    }
+    std::cout << std::setw(16) << bench_peak_rss_kb() / 1024.0 << std::endl;
+
+    return;
+}
+
+//******************************************************************************
+
+/*!
+ * @brief Runs a benchmark case in a child process.
+ *
+ * The SystemC kernel can neither be reset nor can its objects be removed
+ * after elaboration. Every case therefore elaborates its own model in a
+ * fresh process, which also makes the reported peak RSS specific to the
+ * case. The parent process must not create any SystemC object.
+ */
+inline void bench_run_isolated(const char* case_name, bench_case_type bench_case, const std::size_t size)
+{
+    std::cout.flush();
+
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        bench_result result = bench_case(size);
+        bench_print_result(case_name, result);
+        std::cout.flush();
+        _exit(0);
+    }
+
+    int status = 0;
+    if ((pid < 0) || (waitpid(pid, &status, 0) < 0) || !WIFEXITED(status) ||
+        (WEXITSTATUS(status) != 0))
+    {
+        std::cerr << "bench: " << case_name << " (" << size << ") failed" << std::endl;
+    }
+
+    return;
+}
+
+//******************************************************************************
+
+/*!
+ * @brief Sizes from 1000 up to max_size in decades.
+ */
+inline std::vector<std::size_t> bench_sizes(const std::size_t max_size)
+{
+    std::vector<std::size_t> sizes;
+    for (std::size_t size = 1000; size <= max_size; size *= 10)
+    {
+        sizes.push_back(size);
+    }
+
+    return sizes;
+}
+
+//******************************************************************************
+
+/*!
+ * @brief Reads the maximum size from the command line, e.g. "-max 10000000".
+ */
+inline std::size_t bench_max_size(int argc, char* argv[], const std::size_t default_size)
+{
+    for (int i = 1; i + 1 < argc; ++i)
+    {
+        if (std::string(argv[i]) == "-max")
+        {
+            return std::strtoul(argv[i+1], NULL, 10);
+        }
+    }
+
+    return default_size;
+}
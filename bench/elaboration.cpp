@@ -0,0 +1,264 @@
+/*!
+ * @file elaboration.cpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Benchmark of the elaboration cost of sc_map: construction, binding,
+ *        sensitivity and trace registration.
+ *
+ * Usage: sc_map_bench_elaboration [-max <elements>]
+ *
+ * The containers are never deleted, as each case runs in a child process
+ * that exits right after the measurement.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#include "../include/sc_map.hpp"
+#include "bench_util.hpp"
+
+#include <systemc.h>
+
+#include <vector>
+#include <cmath>
+
+//******************************************************************************
+static std::size_t side_length(const std::size_t size, const unsigned int dimensions)
+{
+    std::size_t side = static_cast<std::size_t>(std::pow(static_cast<double>(size), 1.0 / dimensions) + 0.5);
+
+    return (side > 0) ? side : 1;
+}
+
+//******************************************************************************
+class bench_sink : public sc_module
+{
+public:
+    sc_map_linear<sc_in<int> > input;
+    double sensitivity_ns;
+
+    void process_input()
+    {}
+
+    bench_sink(sc_module_name _name, const std::size_t size, const bool register_sensitivity) :
+            input(size, "input"),
+            sensitivity_ns(0.0)
+    {
+        if (register_sensitivity)
+        {
+            SC_METHOD(process_input);
+            bench_timer timer;
+            sensitive << input;
+            sensitivity_ns = timer.elapsed_ns();
+        }
+
+        return;
+    }
+
+    SC_HAS_PROCESS(bench_sink);
+};
+
+//******************************************************************************
+static bench_result construct_linear(const std::size_t size)
+{
+    bench_result result;
+    bench_timer timer;
+    sc_map_linear<sc_signal<int> >* signals = new sc_map_linear<sc_signal<int> >(size, "signals");
+    result.total_ns = timer.elapsed_ns();
+    result.element_cnt = signals->range.size();
+    result.operation_cnt = result.element_cnt;
+
+    return result;
+}
+
+//******************************************************************************
+static bench_result construct_square(const std::size_t size)
+{
+    const std::size_t side = side_length(size, 2);
+
+    bench_result result;
+    bench_timer timer;
+    sc_map_square<sc_signal<int> >* signals = new sc_map_square<sc_signal<int> >(side, side, "signals");
+    result.total_ns = timer.elapsed_ns();
+    result.element_cnt = signals->range.size();
+    result.operation_cnt = result.element_cnt;
+
+    return result;
+}
+
+//******************************************************************************
+static bench_result construct_cube(const std::size_t size)
+{
+    const std::size_t side = side_length(size, 3);
+
+    bench_result result;
+    bench_timer timer;
+    sc_map_cube<sc_signal<int> >* signals = new sc_map_cube<sc_signal<int> >(side, side, side, "signals");
+    result.total_ns = timer.elapsed_ns();
+    result.element_cnt = signals->range.size();
+    result.operation_cnt = result.element_cnt;
+
+    return result;
+}
+
+//******************************************************************************
+static bench_result construct_4d(const std::size_t size)
+{
+    const std::size_t side = side_length(size, 4);
+
+    bench_result result;
+    bench_timer timer;
+    sc_map_4d<sc_signal<int> >* signals = new sc_map_4d<sc_signal<int> >(side, side, side, side, "signals");
+    result.total_ns = timer.elapsed_ns();
+    result.element_cnt = signals->range.size();
+    result.operation_cnt = result.element_cnt;
+
+    return result;
+}
+
+//******************************************************************************
+static bench_result construct_list(const std::size_t size)
+{
+    std::vector<int> keys;
+    keys.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        keys.push_back(static_cast<int>(i * 3));
+    }
+
+    bench_result result;
+    bench_timer timer;
+    sc_map_list<int, sc_signal<int> >* signals = new sc_map_list<int, sc_signal<int> >(keys, "signals");
+    result.total_ns = timer.elapsed_ns();
+    result.element_cnt = signals->range.size();
+    result.operation_cnt = result.element_cnt;
+
+    return result;
+}
+
+//******************************************************************************
+static bench_result bind_map(const std::size_t size)
+{
+    sc_map_linear<sc_signal<int> >* signals = new sc_map_linear<sc_signal<int> >(size, "signals");
+    bench_sink* sink = new bench_sink("sink", size, false);
+
+    bench_result result;
+    bench_timer timer;
+    sink->input.bind(*signals);
+    result.total_ns = timer.elapsed_ns();
+    result.element_cnt = size;
+    result.operation_cnt = size;
+
+    return result;
+}
+
+//******************************************************************************
+static bench_result bind_slices(const std::size_t size)
+{
+    const std::size_t slice_cnt = 16;
+    sc_map_linear<sc_signal<int> >* signals = new sc_map_linear<sc_signal<int> >(size, "signals");
+    bench_sink* sink = new bench_sink("sink", size, false);
+
+    bench_result result;
+    bench_timer timer;
+    for (std::size_t slice = 0; slice < slice_cnt; ++slice)
+    {
+        const sc_map_linear_key start_key(static_cast<int>(slice * size / slice_cnt));
+        const sc_map_linear_key end_key(static_cast<int>((slice + 1) * size / slice_cnt) - 1);
+        if (end_key.X < start_key.X)
+        {
+            continue;
+        }
+        sink->input(start_key, end_key).bind((*signals)(start_key, end_key));
+    }
+    result.total_ns = timer.elapsed_ns();
+    result.element_cnt = size;
+    result.operation_cnt = size;
+
+    return result;
+}
+
+//******************************************************************************
+static bench_result sensitivity(const std::size_t size)
+{
+    bench_sink* sink = new bench_sink("sink", size, true);
+
+    bench_result result;
+    result.total_ns = sink->sensitivity_ns;
+    result.element_cnt = size;
+    result.operation_cnt = size;
+
+    return result;
+}
+
+//******************************************************************************
+static bench_result trace(const std::size_t size)
+{
+    sc_map_linear<sc_signal<int> >* signals = new sc_map_linear<sc_signal<int> >(size, "signals");
+    sc_trace_file* trace_file = sc_create_vcd_trace_file("bench_trace");
+
+    bench_result result;
+    bench_timer timer;
+    sc_trace(trace_file, *signals, "signals");
+    result.total_ns = timer.elapsed_ns();
+    result.element_cnt = size;
+    result.operation_cnt = size;
+
+    return result;
+}
+
+//******************************************************************************
+static bench_result trace_bus(const std::size_t size)
+{
+    sc_map_linear<sc_signal<bool> >* signals = new sc_map_linear<sc_signal<bool> >(size, "signals");
+    sc_trace_file* trace_file = sc_create_vcd_trace_file("bench_trace");
+
+    bench_result result;
+    bench_timer timer;
+    sc_trace_bus(trace_file, *signals, "signals");
+    result.total_ns = timer.elapsed_ns();
+    result.element_cnt = size;
+    result.operation_cnt = size;
+
+    return result;
+}
+
+//******************************************************************************
+int sc_main(int argc, char* argv[])
+{
+    const std::size_t max_size = bench_max_size(argc, argv, 1000000);
+    const std::vector<std::size_t> sizes = bench_sizes(max_size);
+
+    struct
+    {
+        const char* name;
+        bench_case_type function;
+    } cases[] = {
+        {"construct linear", construct_linear},
+        {"construct square", construct_square},
+        {"construct cube", construct_cube},
+        {"construct 4d", construct_4d},
+        {"construct list", construct_list},
+        {"bind map", bind_map},
+        {"bind slices", bind_slices},
+        {"sensitive <<", sensitivity},
+        {"sc_trace", trace},
+        {"sc_trace_bus", trace_bus}
+    };
+
+    bench_print_header("element");
+    for (std::size_t case_id = 0; case_id < sizeof(cases) / sizeof(cases[0]); ++case_id)
+    {
+        for (std::vector<std::size_t>::const_iterator size_it = sizes.begin();
+             size_it != sizes.end();
+             ++size_it)
+        {
+            bench_run_isolated(cases[case_id].name, cases[case_id].function, *size_it);
+        }
+    }
+
+    return 0;
+}
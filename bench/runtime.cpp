@@ -0,0 +1,370 @@
+/*!
+ * @file runtime.cpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Benchmark of the simulation-time cost of sc_map: iteration, lookup,
+ *        slices, write broadcasts and get_key().
+ *
+ * Usage: sc_map_bench_runtime [-max <elements>]
+ *
+ * The operations are executed from sc_main after the end of elaboration, a
+ * write broadcast is followed by one delta cycle, so that the update phase of
+ * the signals is included. Heap allocations are counted by replacing the
+ * global operator new.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#include "../include/sc_map.hpp"
+#include "bench_util.hpp"
+
+#include <systemc.h>
+
+#include <vector>
+#include <string>
+#include <new>
+#include <cmath>
+#include <cstdlib>
+
+//******************************************************************************
+static std::size_t allocation_cnt = 0;
+
+// GCC 11 and later warn about the matching malloc/free of the replacement
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 11)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size)
+{
+    ++allocation_cnt;
+    void* memory = std::malloc((size > 0) ? size : 1);
+    if (memory == NULL)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+
+    return;
+}
+
+//******************************************************************************
+static const std::size_t min_operation_cnt = 1 << 22;
+static volatile long result_sink = 0;
+
+typedef sc_signal<int> signal_type;
+
+//******************************************************************************
+
+/*!
+ * @brief Measures the time and the allocations between start() and stop().
+ */
+class bench_measurement
+{
+public:
+    void start()
+    {
+        start_allocations = allocation_cnt;
+        timer.restart();
+
+        return;
+    }
+
+    bench_result stop(const std::size_t element_cnt, const std::size_t operation_cnt)
+    {
+        bench_result result;
+        result.element_cnt = element_cnt;
+        result.total_ns = timer.elapsed_ns();
+        result.allocations = static_cast<double>(allocation_cnt - start_allocations);
+        result.operation_cnt = operation_cnt;
+
+        return result;
+    }
+
+private:
+    bench_timer timer;
+    std::size_t start_allocations;
+};
+
+//******************************************************************************
+static std::size_t side_length(const std::size_t size, const unsigned int dimensions)
+{
+    std::size_t side = static_cast<std::size_t>(std::pow(static_cast<double>(size), 1.0 / dimensions) + 0.5);
+
+    return (side > 0) ? side : 1;
+}
+
+//******************************************************************************
+static std::size_t repetitions(const std::size_t size)
+{
+    return (min_operation_cnt + size - 1) / size;
+}
+
+//******************************************************************************
+static void create_map(const std::size_t size, sc_map_linear<signal_type>*& map)
+{
+    map = new sc_map_linear<signal_type>(size, "signals");
+
+    return;
+}
+
+//******************************************************************************
+static void create_map(const std::size_t size, sc_map_square<signal_type>*& map)
+{
+    const std::size_t side = side_length(size, 2);
+    map = new sc_map_square<signal_type>(side, side, "signals");
+
+    return;
+}
+
+//******************************************************************************
+static void create_map(const std::size_t size, sc_map_cube<signal_type>*& map)
+{
+    const std::size_t side = side_length(size, 3);
+    map = new sc_map_cube<signal_type>(side, side, side, "signals");
+
+    return;
+}
+
+//******************************************************************************
+static void create_map(const std::size_t size, sc_map_4d<signal_type>*& map)
+{
+    const std::size_t side = side_length(size, 4);
+    map = new sc_map_4d<signal_type>(side, side, side, side, "signals");
+
+    return;
+}
+
+//******************************************************************************
+static void create_map(const std::size_t size, sc_map_list<int, signal_type>*& map)
+{
+    std::vector<int> keys;
+    keys.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        keys.push_back(static_cast<int>(i * 3));
+    }
+    map = new sc_map_list<int, signal_type>(keys, "signals");
+
+    return;
+}
+
+//******************************************************************************
+template <typename map_T>
+bench_result iterate(map_T& map)
+{
+    const std::size_t size = map.range.size();
+    const std::size_t repetition_cnt = repetitions(size);
+    long sum = 0;
+
+    bench_measurement measurement;
+    measurement.start();
+    for (std::size_t repetition = 0; repetition < repetition_cnt; ++repetition)
+    {
+        for (typename map_T::iterator signal_it = map.begin();
+             signal_it != map.end();
+             ++signal_it)
+        {
+            sum += signal_it->read();
+        }
+    }
+    bench_result result = measurement.stop(size, size * repetition_cnt);
+    result_sink = sum;
+
+    return result;
+}
+
+//******************************************************************************
+template <typename map_T>
+bench_result lookup(map_T& map)
+{
+    const std::size_t size = map.range.size();
+    const std::size_t key_cnt = (size < (1 << 20)) ? size : (1 << 20);
+
+    std::vector<typename map_T::key_type> keys;
+    keys.reserve(key_cnt);
+    unsigned long random_value = 12345;
+    for (std::size_t i = 0; i < key_cnt; ++i)
+    {
+        random_value = random_value * 6364136223846793005UL + 1442695040888963407UL;
+        keys.push_back(map.range.key_at((random_value >> 16) % size));
+    }
+
+    const std::size_t repetition_cnt = repetitions(key_cnt);
+    long sum = 0;
+
+    bench_measurement measurement;
+    measurement.start();
+    for (std::size_t repetition = 0; repetition < repetition_cnt; ++repetition)
+    {
+        for (std::size_t i = 0; i < key_cnt; ++i)
+        {
+            sum += map.at(keys[i]).read();
+        }
+    }
+    bench_result result = measurement.stop(size, key_cnt * repetition_cnt);
+    result_sink = sum;
+
+    return result;
+}
+
+//******************************************************************************
+
+/*!
+ * @brief Iterates the slice between the keys at a quarter and at three
+ *        quarters of the range, the slice is created for every repetition.
+ */
+template <typename map_T>
+bench_result slice(map_T& map)
+{
+    const std::size_t size = map.range.size();
+    const typename map_T::key_type start_key = map.range.key_at(size / 4);
+    const typename map_T::key_type end_key = map.range.key_at((3 * size) / 4);
+
+    std::size_t slice_size = 0;
+    for (typename map_T::iterator signal_it = map(start_key, end_key);
+         signal_it != map.end();
+         ++signal_it)
+    {
+        ++slice_size;
+    }
+
+    const std::size_t repetition_cnt = repetitions(slice_size);
+    long sum = 0;
+
+    bench_measurement measurement;
+    measurement.start();
+    for (std::size_t repetition = 0; repetition < repetition_cnt; ++repetition)
+    {
+        for (typename map_T::iterator signal_it = map(start_key, end_key);
+             signal_it != map.end();
+             ++signal_it)
+        {
+            sum += signal_it->read();
+        }
+    }
+    bench_result result = measurement.stop(size, slice_size * repetition_cnt);
+    result_sink = sum;
+
+    return result;
+}
+
+//******************************************************************************
+template <typename map_T>
+bench_result write_broadcast(map_T& map)
+{
+    const std::size_t size = map.range.size();
+    const std::size_t repetition_cnt = repetitions(size);
+
+    bench_measurement measurement;
+    measurement.start();
+    for (std::size_t repetition = 0; repetition < repetition_cnt; ++repetition)
+    {
+        map.write(static_cast<int>(repetition + 1));
+        sc_start(SC_ZERO_TIME);
+    }
+
+    return measurement.stop(size, size * repetition_cnt);
+}
+
+//******************************************************************************
+template <typename map_T>
+bench_result get_key(map_T& map)
+{
+    std::vector<typename map_T::object_type*> objects;
+    for (typename map_T::iterator signal_it = map.begin();
+         signal_it != map.end();
+         ++signal_it)
+    {
+        objects.push_back(&(*signal_it));
+    }
+
+    const std::size_t repetition_cnt = repetitions(objects.size());
+    long found_cnt = 0;
+
+    bench_measurement measurement;
+    measurement.start();
+    for (std::size_t repetition = 0; repetition < repetition_cnt; ++repetition)
+    {
+        for (std::size_t i = 0; i < objects.size(); ++i)
+        {
+            found_cnt += map.get_key(*objects[i]).first ? 1 : 0;
+        }
+    }
+    bench_result result = measurement.stop(objects.size(), objects.size() * repetition_cnt);
+    result_sink = found_cnt;
+
+    return result;
+}
+
+//******************************************************************************
+template <typename map_T, bench_result (*operation)(map_T&)>
+bench_result run_case(const std::size_t size)
+{
+    map_T* map;
+    create_map(size, map);
+    sc_start(SC_ZERO_TIME);
+
+    return operation(*map);
+}
+
+//******************************************************************************
+struct bench_case
+{
+    std::string name;
+    bench_case_type function;
+};
+
+//******************************************************************************
+template <typename map_T>
+void add_cases(std::vector<bench_case>& cases, const std::string& map_name)
+{
+    bench_case new_cases[] = {
+        {map_name + " iterate", run_case<map_T, iterate<map_T> >},
+        {map_name + " at()", run_case<map_T, lookup<map_T> >},
+        {map_name + " slice", run_case<map_T, slice<map_T> >},
+        {map_name + " write", run_case<map_T, write_broadcast<map_T> >},
+        {map_name + " get_key()", run_case<map_T, get_key<map_T> >}
+    };
+    cases.insert(cases.end(), new_cases, new_cases + sizeof(new_cases) / sizeof(new_cases[0]));
+
+    return;
+}
+
+//******************************************************************************
+int sc_main(int argc, char* argv[])
+{
+    const std::size_t max_size = bench_max_size(argc, argv, 1000000);
+    const std::vector<std::size_t> sizes = bench_sizes(max_size);
+
+    std::vector<bench_case> cases;
+    add_cases<sc_map_linear<signal_type> >(cases, "linear");
+    add_cases<sc_map_square<signal_type> >(cases, "square");
+    add_cases<sc_map_cube<signal_type> >(cases, "cube");
+    add_cases<sc_map_4d<signal_type> >(cases, "4d");
+    add_cases<sc_map_list<int, signal_type> >(cases, "list");
+
+    bench_print_header("op");
+    for (std::vector<bench_case>::const_iterator case_it = cases.begin();
+         case_it != cases.end();
+         ++case_it)
+    {
+        for (std::vector<std::size_t>::const_iterator size_it = sizes.begin();
+             size_it != sizes.end();
+             ++size_it)
+        {
+            bench_run_isolated(case_it->name.c_str(), case_it->function, *size_it);
+        }
+    }
+
+    return 0;
+}
@@ -20,3 +20,7 @@
 #include "sc_map_square.hpp"
 #include "sc_map_cube.hpp"
 #include "sc_map_4d.hpp"
+#include "sc_map_nd.hpp"
+#include "sc_map_fixed.hpp"
+#include "sc_map_pattern_range.hpp"
+#include "sc_map_packed_bool.hpp"
@@ -13,7 +13,7 @@
 
 #pragma once
 
-#include "sc_map_base.hpp"
+#include "sc_map_nd.hpp"
 #include <systemc.h>
 
 #include <string>
@@ -24,11 +24,23 @@
 
 //******************************************************************************
 
+/*!
+ * @brief Container for a regular structure with 4 dimensions.
+ *
+ * The keys of the container are the non-virtual sc_map_nd_key<4>. Keys of
+ * type sc_map_4d_key convert implicitly to them and back, e.g. for at() or
+ * for the keys returned by get_key().
+
+ * The indexes of the packed key are limited to [-32768, 32767], see
+ * sc_map_packed_key.
+ *
+ * @tparam object_T Type of the objects in the container.
+ */
 template <typename object_T>
-class sc_map_4d : public sc_map_base<sc_map_4d_range, object_T>
+class sc_map_4d : public sc_map_nd<4, object_T>
 {
 public:
-    typedef sc_map_base<sc_map_4d_range, object_T> base;
+    typedef sc_map_nd<4, object_T> base;
     typedef typename base::range_type range_type;
     typedef typename base::key_type key_type;
     typedef typename base::key_vector_type key_vector_type;
@@ -52,8 +64,6 @@ public:
 
     virtual ~sc_map_4d() {};
 
-    object_T& at(const index_type& Z, const index_type& Y, const index_type& X, const index_type& W);
-
     const char* kind() const;
 };
 
@@ -64,15 +74,13 @@ template <typename object_T>
 sc_map_4d<object_T>::sc_map_4d(const size_type element_cnt_Z,
         const size_type element_cnt_Y, const size_type element_cnt_X,
         const size_type element_cnt_W, const sc_module_name name) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(sc_map_4d_key(),
             sc_map_4d_key(element_cnt_Z-1, element_cnt_Y-1, element_cnt_X-1, element_cnt_W-1));
 
     this->init(range, typename base::creator());
 
-   // simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -83,15 +91,13 @@ sc_map_4d<object_T>::sc_map_4d(const size_type element_cnt_Z,
         const size_type element_cnt_W, const sc_module_name name,
         const index_type start_id_Z, const index_type start_id_Y,
         const index_type start_id_X, const index_type start_id_W) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(sc_map_4d_key(start_id_Z, start_id_Y, start_id_X, start_id_W),
             sc_map_4d_key(start_id_Z+element_cnt_Z-1, start_id_Y+element_cnt_Y-1, start_id_X+element_cnt_X-1, start_id_W+element_cnt_W-1));
 
     this->init(range, typename base::creator());
 
-   // simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -102,15 +108,13 @@ sc_map_4d<object_T>::sc_map_4d(const size_type element_cnt_Z,
         const size_type element_cnt_Y, const size_type element_cnt_X,
         const size_type element_cnt_W, const sc_module_name name,
         const config_type configuration) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(sc_map_4d_key(),
             sc_map_4d_key(element_cnt_Z-1, element_cnt_Y-1, element_cnt_X-1, element_cnt_W-1));
 
     this->init(range, typename base::creator(), configuration);
 
-    //simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -123,15 +127,13 @@ sc_map_4d<object_T>::sc_map_4d(const size_type element_cnt_Z,
         const config_type configuration, const index_type start_id_Z,
         const index_type start_id_Y, const index_type start_id_X,
         const index_type start_id_W) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(sc_map_4d_key(start_id_Z, start_id_Y, start_id_X, start_id_W),
             sc_map_4d_key(start_id_Z+element_cnt_Z-1, start_id_Y+element_cnt_Y-1, start_id_X+element_cnt_X-1, start_id_W+element_cnt_W-1));
 
     this->init(range, typename base::creator(), configuration);
 
-   // simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -139,13 +141,11 @@ sc_map_4d<object_T>::sc_map_4d(const size_type element_cnt_Z,
 template <typename object_T>
 sc_map_4d<object_T>::sc_map_4d(const key_type& start_key,
         const key_type& end_key, const sc_module_name name) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(start_key, end_key);
     this->init(range, typename base::creator());
 
-   // simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -155,13 +155,11 @@ template <typename config_type>
 sc_map_4d<object_T>::sc_map_4d(const key_type& start_key,
         const key_type& end_key, const sc_module_name name,
         const config_type& configuration) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(start_key, end_key);
     this->init(range, typename base::creator(), configuration);
 
-  //  simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -169,12 +167,10 @@ sc_map_4d<object_T>::sc_map_4d(const key_type& start_key,
 template <typename object_T>
 sc_map_4d<object_T>::sc_map_4d(const range_type& new_range,
         const sc_module_name name) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     this->init(new_range, typename base::creator());
 
-  //  simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -183,23 +179,13 @@ template <typename object_T>
 template <typename config_type>
 sc_map_4d<object_T>::sc_map_4d(const range_type& new_range,
         const sc_module_name name, const config_type& configuration) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     this->init(new_range, typename base::creator(), configuration);
 
-  //  simulation_size.add_sc_map(kind());
-
     return;
 }
 
-//******************************************************************************
-template <typename object_T>
-object_T& sc_map_4d<object_T>::at(const index_type& Z, const index_type& Y,
-        const index_type& X, const index_type& W)
-{
-    return base::at(key_type(Z, Y, X, W));
-}
-
 //******************************************************************************
 template <typename object_T>
 const char* sc_map_4d<object_T>::kind() const
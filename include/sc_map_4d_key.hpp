@@ -14,17 +14,41 @@
 #pragma once
 
 #include "sc_map_regular_key.hpp"
+#include "sc_map_packed_key.hpp"
 #include "sc_map_config.hpp"
 
 #include <string>
 #include <sstream>
+#include <functional>
 
 //******************************************************************************
 
+/*!
+ * @brief Key with the named indexes Z, Y, X, W of a structure with 4 dimensions.
+ *
+ * The key is polymorphic and compared through the sc_map_key interface. The
+ * containers use the non-virtual sc_map_packed_key<4> instead. This key
+ * converts implicitly from and to it, so that it can be passed wherever a key
+ * of sc_map_4d is expected and receive the keys of the container.
+ */
 class sc_map_4d_key : public sc_map_regular_key
 {
 public:
     using sc_map_regular_key::index_type;
+    typedef sc_map_packed_key<4> packed_type;
+
+    class Comperator
+    {
+    public:
+        bool operator()(const sc_map_4d_key& lhs, const sc_map_4d_key& rhs) const
+        {
+            return lhs < rhs;
+        }
+    };
+
+    using sc_map_key::operator==;
+    using sc_map_key::operator!=;
+    using sc_map_key::operator<;
 
     index_type Z;
     index_type Y;
@@ -33,10 +57,127 @@ public:
 
     sc_map_4d_key();
     sc_map_4d_key(const index_type& Z, const index_type& Y, const index_type& X, const index_type& W);
+    sc_map_4d_key(const packed_type& packed_key);
     virtual ~sc_map_4d_key() {};
 
     virtual std::string get_string() const;
+    virtual void append_string(std::string& buffer) const;
+    packed_type packed() const;
+
+    /*!
+     * @brief Converts the key to the key of sc_map_4d, see packed().
+     */
+    operator packed_type() const;
+
+    index_type& operator[](const unsigned int dim);
+    const index_type& operator[](const unsigned int dim) const;
+    void set(const unsigned int dim, const index_type index);
 
     virtual bool operator==(const sc_map_key& other_key) const;
     virtual bool operator<(const sc_map_key& other_key) const;
+
+    bool operator==(const sc_map_4d_key& other_key) const;
+    bool operator!=(const sc_map_4d_key& other_key) const;
+    bool operator<(const sc_map_4d_key& other_key) const;
 };
+
+//******************************************************************************
+namespace std
+{
+template <>
+struct hash<sc_map_4d_key>
+{
+    size_t operator()(const sc_map_4d_key& key) const
+    {
+        size_t seed = sc_map_regular_key::combine_hash(0, key.Z);
+        seed = sc_map_regular_key::combine_hash(seed, key.Y);
+        seed = sc_map_regular_key::combine_hash(seed, key.X);
+
+        return sc_map_regular_key::combine_hash(seed, key.W);
+    }
+};
+}
+
+//******************************************************************************
+
+//******************************************************************************
+inline sc_map_4d_key::index_type& sc_map_4d_key::operator[](const unsigned int dim)
+{
+    switch (dim)
+    {
+    case 0:
+        return Z;
+    case 1:
+        return Y;
+    case 2:
+        return X;
+    default:
+        return W;
+    }
+}
+
+//******************************************************************************
+inline const sc_map_4d_key::index_type& sc_map_4d_key::operator[](const unsigned int dim) const
+{
+    switch (dim)
+    {
+    case 0:
+        return Z;
+    case 1:
+        return Y;
+    case 2:
+        return X;
+    default:
+        return W;
+    }
+}
+
+//******************************************************************************
+inline void sc_map_4d_key::set(const unsigned int dim, const index_type index)
+{
+    (*this)[dim] = index;
+
+    return;
+}
+
+//******************************************************************************
+inline bool sc_map_4d_key::operator==(const sc_map_4d_key& other_key) const
+{
+    return ((Z == other_key.Z) &&
+            (Y == other_key.Y) &&
+            (X == other_key.X) &&
+            (W == other_key.W));
+}
+
+//******************************************************************************
+inline bool sc_map_4d_key::operator!=(const sc_map_4d_key& other_key) const
+{
+    return !(*this == other_key);
+}
+
+//******************************************************************************
+inline bool sc_map_4d_key::operator<(const sc_map_4d_key& other_key) const
+{
+    if (Z != other_key.Z)
+    {
+        return Z < other_key.Z;
+    }
+
+    if (Y != other_key.Y)
+    {
+        return Y < other_key.Y;
+    }
+
+    if (X != other_key.X)
+    {
+        return X < other_key.X;
+    }
+
+    return W < other_key.W;
+}
+
+//******************************************************************************
+inline sc_map_4d_key::operator packed_type() const
+{
+    return packed();
+}
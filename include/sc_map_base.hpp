@@ -14,9 +14,17 @@
 #pragma once
 
 #include "sc_map_iterator.hpp"
+#include "sc_map_view.hpp"
+#include "sc_map_storage.hpp"
+#include "sc_map_change_monitor.hpp"
+#include "sc_map_bus_trace.hpp"
 #include "sc_map_config.hpp"
+#include "sc_map_profiler.hpp"
+#include "sc_map_trace.hpp"
 
-//#include "../../sc_analyzer/include/size_analyzer.hpp"
+#ifdef SC_MAP_SIZE_ANALYZER
+    #include "size_analyzer.hpp"
+#endif
 
 #include <systemc.h>
 
@@ -24,37 +32,61 @@
 #include <map>
 #include <string>
 #include <sstream>
+#include <new>
+#include <stdexcept>
 
 //******************************************************************************
 template <typename range_T, typename object_T>
 class sc_map_base : public sc_object
 {
-    friend class sc_map_iterator<sc_map_base<range_T, object_T> >;
+    friend class sc_map_iterator<sc_map_base<range_T, object_T>, range_T>;
 
 public:
     typedef range_T range_type;
     typedef typename range_type::key_type key_type;
     typedef std::vector<key_type> key_vector_type;
     typedef object_T object_type;
-    typedef std::map<key_type, object_type*, typename key_type::Comperator> map_type;
-    typedef sc_map_iterator<sc_map_base<range_type, object_type> > iterator;
-    typedef typename map_type::size_type size_type;
+    typedef sc_map_storage<range_type, object_type> storage_type;
+    typedef sc_map_iterator<sc_map_base<range_type, object_type>, range_type> iterator;
+    typedef std::size_t size_type;
     typedef object_type* pointer;
 
     sc_map_base(const sc_module_name name);
-    virtual ~sc_map_base() {};
+    virtual ~sc_map_base();
 
     iterator begin();
     iterator end();
 
+    /*!
+    * @brief Returns an iterator over the keys of another range type with the
+    *        same key type, e.g. sc_map_strided_range or sc_map_tiled_range.
+    *
+    * The iterator can be compared with end() and passed to bind().
+    */
+    template <typename other_range_T>
+    sc_map_iterator<sc_map_base<range_T, object_T>, other_range_T> begin(const other_range_T& range);
+
     range_type const * get_range() const;
     std::pair<bool, key_type> get_key(object_type& object) const;
+    std::vector<std::pair<bool, key_type> > get_keys(const std::vector<object_type*>& object_vector) const;
 
     //* todo: const versions needed?
+    /*!
+    * @brief Returns the object of a key.
+    *
+    * A key without object is reported with SC_REPORT_ERROR, which throws an
+    * exception with the default actions of SystemC. If the actions of the
+    * report have been changed to not throw, std::out_of_range is thrown
+    * after the report, as there is no object to return.
+    */
     object_type& at(const key_type& key);
     object_type& operator[] (const key_type& key);
     iterator operator()(const key_type& start_key, const key_type& end_key);
-    iterator operator()(const sc_map_range<key_type>& range);
+    iterator operator()(const range_type& range);
+
+    sc_map_view<range_type, object_type> view();
+    sc_map_view<range_type, object_type> view(const key_type& start_key, const key_type& end_key);
+    sc_map_view<range_type, object_type> view(const range_type& range);
 
     template <typename signal_type>
     void bind(sc_signal<signal_type>& signal);
@@ -64,13 +96,37 @@ public:
     void bind(sc_map_base<signal_range_T, signal_T>& signal_map);
     template <typename signal_range_T, typename signal_T>
     void operator()(sc_map_base<signal_range_T, signal_T>& signal_map);
-    template <typename signal_map_T>
-    void bind(sc_map_iterator<signal_map_T> signal_it);
-    template <typename signal_map_T>
-    void operator()(sc_map_iterator<signal_map_T> signal_it);
+    template <typename signal_map_T, typename signal_it_range_T>
+    void bind(sc_map_iterator<signal_map_T, signal_it_range_T> signal_it);
+    template <typename signal_map_T, typename signal_it_range_T>
+    void operator()(sc_map_iterator<signal_map_T, signal_it_range_T> signal_it);
+    template <typename signal_range_T, typename signal_T>
+    void bind(const sc_map_view<signal_range_T, signal_T>& signal_view);
 
     template<typename data_type>
     void write(const data_type& value);
+    template<typename data_type>
+    void write_all(const std::vector<data_type>& values);
+    void write_bits(const sc_bv_base& bits);
+    template<typename data_type>
+    void read_all(std::vector<data_type>& values);
+    void read_bits(sc_bv_base& bits);
+
+    /*!
+    * @brief Event that is notified once per delta cycle after any signal of
+    *        the container changed, see sc_map_change_monitor.
+    *
+    * The first call, which has to be made during elaboration, spawns one
+    * method process per object of the container, i.e. a container with N
+    * signals adds N processes to the simulation.
+    */
+    const sc_event& changed_event();
+
+    /*!
+    * @brief Returns the keys of the signals that caused the current
+    *        notification of changed_event().
+    */
+    const key_vector_type& changed_keys();
 // todo: allow operator assignment to multiple ports
 //    template<typename data_type>
 //    void operator=(const data_type& value);
@@ -94,58 +150,194 @@ public:
     template <typename Creator, typename config_type>
     void init(const range_type& new_range, const Creator& object_creator, const std::map<key_type, config_type>& configurations);
 
-    map_type objects;
+    storage_type objects;
     range_type range;
 
+    /*!
+     * @brief Constructs the objects of the container in the memory provided by
+     *        the storage.
+     *
+     * The name passed to the creator is the complete name of the object, i.e.
+     * the base name of the container and the key joined by
+     * sc_map::key_separator_char.
+     *
+     * Creators that are passed to init() have the same signature. Creators
+     * written for the former signature
+     * object_type* operator()(const char* name, const key_type& id), which
+     * allocated the object with new, have to take the memory as additional
+     * first parameter and construct the object in it with placement new,
+     * e.g. new (memory) object_type(name). A creator that returns an object
+     * outside of this memory is reported with SC_REPORT_ERROR.
+     */
     class creator
     {
     public:
         creator() {};
-        object_type* operator() (const sc_module_name name, const sc_map_base<range_type, object_type>::key_type& id) const;
+        object_type* operator() (void* memory, const char* name, const sc_map_base<range_type, object_type>::key_type& id) const;
         template <typename config_T>
-        object_type* operator() (const sc_module_name name, const sc_map_base<range_type, object_type>::key_type& id, const config_T& configuration) const;
+        object_type* operator() (void* memory, const char* name, const sc_map_base<range_type, object_type>::key_type& id, const config_T& configuration) const;
     };
 
+private:
+    sc_map_change_monitor<sc_map_base<range_type, object_type> >* change_monitor;
+    sc_map_bus_trace<sc_map_base<range_type, object_type> >* bus_trace;
+
+    /*!
+    * @brief Creates the objects of all keys of new_range, which all init()
+    *        functions share.
+    *
+    * @param object_creator Function object that is called with the memory,
+    *        the name and the key of each object and returns the object, which
+    *        has to be constructed in the memory.
+    *
+    * Memory that the storage cannot provide and objects that are not
+    * constructed in their memory are reported with SC_REPORT_ERROR and stop
+    * the creation of the remaining objects.
+    */
+    template <typename Creator>
+    void create_objects(const range_type& new_range, const Creator& object_creator);
+    void destroy_objects();
+    void record_size();
+    sc_map_change_monitor<sc_map_base<range_type, object_type> >& get_change_monitor();
+    sc_map_bus_trace<sc_map_base<range_type, object_type> >& get_bus_trace();
+
+public:
+
 //* todo: add const to second argument of sc_trace
 template <typename trace_range_T, typename trace_object_T>
 friend void sc_trace(sc_trace_file* tf, sc_map_base<trace_range_T, trace_object_T>& sc_map, const std::string& name);
 
+/*!
+ * @brief Traces the bool signals of the container as a single bit vector
+ *        instead of one entry per signal, see sc_map_bus_trace.
+ *
+ * Has to be called during elaboration. Bit 0 of the vector is the first
+ * signal of the container.
+ */
+template <typename trace_range_T, typename trace_object_T>
+friend void sc_trace_bus(sc_trace_file* tf, sc_map_base<trace_range_T, trace_object_T>& sc_map, const std::string& name);
+
 template <typename signal_range_T, typename signal_T>
 friend sc_sensitive& operator<< (sc_sensitive& sensitivity_list, sc_map_base<signal_range_T, signal_T>& signal_map);
 
 };
 
+//******************************************************************************
+/*!
+ * @brief Traces the objects of the container whose keys are in range, e.g. a
+ *        row of an sc_map_square or an sc_map_strided_range over every 16th
+ *        element of an sc_map_linear.
+ *
+ * The range can be of any range type with the key type of the container.
+ */
+template <typename trace_range_T, typename trace_object_T, typename other_range_T>
+void sc_trace(sc_trace_file* tf, sc_map_base<trace_range_T, trace_object_T>& sc_map, const std::string& name, const other_range_T& range);
+
+//******************************************************************************
+/*!
+ * @brief Traces the objects of the container whose key is accepted by
+ *        predicate, a function object that is called with the key and
+ *        returns bool.
+ */
+template <typename trace_range_T, typename trace_object_T, typename predicate_T>
+void sc_trace_if(sc_trace_file* tf, sc_map_base<trace_range_T, trace_object_T>& sc_map, const std::string& name, const predicate_T& predicate);
+
+//******************************************************************************
+/*!
+ * @brief Traces every interval-th object of the container in the order of its
+ *        range, starting with the first one.
+ */
+template <typename trace_range_T, typename trace_object_T>
+void sc_trace_sampled(sc_trace_file* tf, sc_map_base<trace_range_T, trace_object_T>& sc_map, const std::string& name, const std::size_t interval);
+
+//******************************************************************************
+/*!
+ * @brief Copies a bit vector into the objects of the container and back,
+ *        used by sc_map_base::write_bits() and read_bits().
+ *
+ * These versions go through the objects with an iterator. Containers that
+ * keep their values in words, e.g. sc_map_packed_bool, provide more
+ * specialized overloads, which are also taken through the base class.
+ */
+template <typename range_T, typename object_T>
+void sc_map_write_bits(sc_map_base<range_T, object_T>& sc_map, const sc_bv_base& bits);
+template <typename range_T, typename object_T>
+void sc_map_read_bits(sc_map_base<range_T, object_T>& sc_map, sc_bv_base& bits);
+
 //******************************************************************************
 
 //******************************************************************************
 template <typename range_T, typename object_T>
 sc_map_base<range_T, object_T>::sc_map_base(const sc_module_name name) :
-        sc_object(name)
+        sc_object(name),
+        change_monitor(NULL),
+        bus_trace(NULL)
+{}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_base<range_T, object_T>::~sc_map_base()
 {
-   // simulation_size.add_sc_map();
+    delete change_monitor;
+    delete bus_trace;
+    destroy_objects();
+
+#ifdef SC_MAP_SIZE_ANALYZER
+    simulation_size.remove_sc_map(this);
+#endif
 
     return;
 }
 
 //******************************************************************************
 template <typename range_T, typename object_T>
-template <typename Creator>
-void sc_map_base<range_T, object_T>::init(const range_type& new_range,
-        const Creator& object_creator)
+void sc_map_base<range_T, object_T>::destroy_objects()
 {
-    range = new_range;
-
-    key_vector_type key_vector = range.get_key_vector();
-    for (typename key_vector_type::const_iterator key_it = key_vector.begin();
-         key_it != key_vector.end();
-         ++key_it)
+    if (objects.size() != 0)
     {
-        std::string name = basename();
-        const char* cname = name.c_str();
+        key_vector_type key_vector = range.get_key_vector();
+        for (size_type i = objects.size(); i > 0; --i)
+        {
+            object_type* object = objects.find(range, key_vector[i-1]);
+            object->~object_type();
+        }
+    }
 
-        object_type* p = object_creator(cname, *key_it);
-        objects.insert(typename map_type::value_type(*key_it, p));
+    objects.release();
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_base<range_T, object_T>::record_size()
+{
+#ifdef SC_MAP_SIZE_ANALYZER
+    size_analyzer::map_record record;
+    record.name = name();
+    record.kind = kind();
+    if (objects.size() != 0)
+    {
+        record.element_kind = size_analyzer::kind_of(objects.find(range, range.first()));
     }
+    record.element_cnt = objects.size();
+    record.element_bytes = objects.size() * sizeof(object_type);
+    record.storage_bytes = objects.overhead_bytes();
+    record.range_bytes = sizeof(range_type) + range.heap_size();
+
+    simulation_size.add_sc_map(this, record);
+#endif
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename Creator>
+void sc_map_base<range_T, object_T>::init(const range_type& new_range,
+        const Creator& object_creator)
+{
+    create_objects(new_range, object_creator);
 
     return;
 }
@@ -157,19 +349,11 @@ void sc_map_base<range_T, object_T>::init(const range_type& new_range,
         const Creator& object_creator,
         const config_type& configurator)
 {
-    range = new_range;
-
-    key_vector_type key_vector = range.get_key_vector();
-    for (typename key_vector_type::const_iterator key_it = key_vector.begin();
-         key_it != key_vector.end();
-         ++key_it)
-    {
-        std::string name = basename();
-        const char* cname = name.c_str();
-
-        object_type* p = object_creator(cname, *key_it, configurator);
-        objects.insert(typename map_type::value_type(*key_it, p));
-    }
+    create_objects(new_range,
+            [&](void* memory, const char* object_name, const key_type& key)
+            {
+                return object_creator(memory, object_name, key, configurator);
+            });
 
     return;
 }
@@ -181,22 +365,13 @@ void sc_map_base<range_T, object_T>::init(const range_type& new_range,
         const Creator& object_creator,
         const std::vector<config_type>& configurations)
 {
-    range = new_range;
-
-    key_vector_type key_vector = range.get_key_vector();
+    // the objects are created in the order of the range
     typename std::vector<config_type>::const_iterator config_it = configurations.begin();
-    for (typename key_vector_type::const_iterator key_it = key_vector.begin();
-         key_it != key_vector.end();
-         ++key_it)
-    {
-        std::string name = basename();
-        const char* cname = name.c_str();
-
-        object_type* p = object_creator(cname, *key_it, *config_it);
-        objects.insert(typename map_type::value_type(*key_it, p));
-
-        ++config_it;
-    }
+    create_objects(new_range,
+            [&](void* memory, const char* object_name, const key_type& key)
+            {
+                return object_creator(memory, object_name, key, *config_it++);
+            });
 
     return;
 }
@@ -208,20 +383,71 @@ void sc_map_base<range_T, object_T>::init(const range_type& new_range,
         const Creator& object_creator,
         const std::map<key_type, config_type>& configurations)
 {
+    create_objects(new_range,
+            [&](void* memory, const char* object_name, const key_type& key)
+            {
+                return object_creator(memory, object_name, key, configurations.at(key));
+            });
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename Creator>
+void sc_map_base<range_T, object_T>::create_objects(const range_type& new_range,
+        const Creator& object_creator)
+{
+    SC_MAP_PROFILE(name(), "init");
+
+    destroy_objects();
     range = new_range;
 
     key_vector_type key_vector = range.get_key_vector();
+    objects.init(range, key_vector.size());
+
+    std::string object_name = basename();
+    object_name += sc_map::key_separator_char;
+    const std::string::size_type prefix_size = object_name.size();
     for (typename key_vector_type::const_iterator key_it = key_vector.begin();
          key_it != key_vector.end();
          ++key_it)
     {
-        std::string name = basename();
-        const char* cname = name.c_str();
+        object_name.resize(prefix_size);
+        key_it->append_string(object_name);
 
-        object_type* p = object_creator(cname, *key_it, configurations.at(*key_it));
-        objects.push_back(map_type::value_type(*key_it, p));
+        void* memory = objects.allocate(range, *key_it);
+        if (memory == NULL)
+        {
+            std::string message = name();
+            message += ": no memory for the object with key ";
+            key_it->append_string(message);
+            SC_REPORT_ERROR("sc_map_base", message.c_str());
+            break;
+        }
+
+        object_type* p;
+        {
+            SC_MAP_PROFILE_UNTRACED(name(), "creator");
+            p = object_creator(memory, object_name.c_str(), *key_it);
+        }
+
+        // the storage finds the objects and their keys by their position
+        if (p != memory)
+        {
+            std::string message = name();
+            message += ": the creator did not construct the object with key ";
+            key_it->append_string(message);
+            message += " in the memory it was passed";
+            SC_REPORT_ERROR("sc_map_base", message.c_str());
+            break;
+        }
+
+        objects.insert(range, *key_it, p);
     }
 
+    record_size();
+
     return;
 }
 
@@ -241,6 +467,15 @@ typename sc_map_base<range_T, object_T>::iterator
     return iterator(this, iterator::end);
 }
 
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename other_range_T>
+sc_map_iterator<sc_map_base<range_T, object_T>, other_range_T>
+        sc_map_base<range_T, object_T>::begin(const other_range_T& range)
+{
+    return sc_map_iterator<sc_map_base<range_type, object_type>, other_range_T>(this, range);
+}
+
 //******************************************************************************
 template <typename range_T, typename object_T>
 typename sc_map_base<range_T, object_T>::range_type const *
@@ -255,21 +490,25 @@ std::pair<bool, typename sc_map_base<range_T, object_T>::key_type>
         sc_map_base<range_T, object_T>::get_key(object_type& object) const
 {
     std::pair<bool, key_type> key_pair;
-    key_pair.first = false;
+    key_pair.first = objects.find_key(range, &object, key_pair.second);
 
-    for (typename map_type::const_iterator object_it = objects.begin();
-         object_it != objects.end();
-         ++object_it)
+    return key_pair;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+std::vector<std::pair<bool, typename sc_map_base<range_T, object_T>::key_type> >
+        sc_map_base<range_T, object_T>::get_keys(
+        const std::vector<object_type*>& object_vector) const
+{
+    std::vector<std::pair<bool, key_type> > key_pairs(object_vector.size());
+
+    for (size_type i = 0; i < object_vector.size(); ++i)
     {
-        if (object_it->second == &object)
-        {
-            key_pair.first = true;
-            key_pair.second = object_it->first;
-            break;
-        }
+        key_pairs[i].first = objects.find_key(range, object_vector[i], key_pairs[i].second);
     }
 
-    return key_pair;
+    return key_pairs;
 }
 
 //******************************************************************************
@@ -277,10 +516,17 @@ template <typename range_T, typename object_T>
 typename sc_map_base<range_T, object_T>::object_type&
         sc_map_base<range_T, object_T>::at(const key_type& key)
 {
-    // todo: at exception handling for out range accesses
-    object_type& ret_object = *(this->objects[key]);
+    object_type* object = objects.find(range, key);
+    if (object == NULL)
+    {
+        std::string message = name();
+        message += ": no object with key ";
+        key.append_string(message);
+        SC_REPORT_ERROR("sc_map_base", message.c_str());
+        throw std::out_of_range(message);
+    }
 
-    return ret_object;
+    return *object;
 }
 
 //******************************************************************************
@@ -303,16 +549,41 @@ typename sc_map_base<range_T, object_T>::iterator
 //******************************************************************************
 template <typename range_T, typename object_T>
 typename sc_map_base<range_T, object_T>::iterator
-sc_map_base<range_T, object_T>::operator()(const sc_map_range<key_type>& range)
+sc_map_base<range_T, object_T>::operator()(const range_type& range)
 {
     return iterator(this, range);
 }
 
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_view<range_T, object_T> sc_map_base<range_T, object_T>::view()
+{
+    return sc_map_view<range_type, object_type>(*this);
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_view<range_T, object_T> sc_map_base<range_T, object_T>::view(
+        const key_type& start_key, const key_type& end_key)
+{
+    return sc_map_view<range_type, object_type>(*this, start_key, end_key);
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_view<range_T, object_T> sc_map_base<range_T, object_T>::view(
+        const range_type& range)
+{
+    return sc_map_view<range_type, object_type>(*this, range);
+}
+
 //******************************************************************************
 template <typename range_T, typename object_T>
 template <typename signal_T>
 void sc_map_base<range_T, object_T>::bind(sc_signal<signal_T>& signal)
 {
+    SC_MAP_PROFILE(name(), "bind(signal)");
+
     for (iterator port_it = begin(); port_it != end(); ++port_it)
     {
         port_it->bind(signal);
@@ -337,6 +608,8 @@ template <typename signal_range_T, typename signal_T>
 void sc_map_base<range_T, object_T>::bind(sc_map_base<signal_range_T, signal_T>&
         signal_map)
 {
+    SC_MAP_PROFILE(name(), "bind(map)");
+
     bind(signal_map.begin());
 
     return;
@@ -355,13 +628,16 @@ void sc_map_base<range_T, object_T>::operator()(
 
 //******************************************************************************
 template <typename range_T, typename object_T>
-template <typename signal_map_T>
-void sc_map_base<range_T, object_T>::bind(sc_map_iterator<signal_map_T> signal_it)
+template <typename signal_map_T, typename signal_it_range_T>
+void sc_map_base<range_T, object_T>::bind(
+        sc_map_iterator<signal_map_T, signal_it_range_T> signal_it)
 {
     // todo: check for equal size
     // todo: check for same object
     // todo: check for compatibility of port and signal (pre-processor)
 
+    SC_MAP_PROFILE(name(), "bind(iterator)");
+
     for (iterator port_it = this->begin();
          port_it != this->end();
          ++port_it)
@@ -376,15 +652,28 @@ void sc_map_base<range_T, object_T>::bind(sc_map_iterator<signal_map_T> signal_i
 
 //******************************************************************************
 template <typename range_T, typename object_T>
-template <typename signal_map_T>
+template <typename signal_map_T, typename signal_it_range_T>
 void sc_map_base<range_T, object_T>::operator()(
-        sc_map_iterator<signal_map_T> signal_it)
+        sc_map_iterator<signal_map_T, signal_it_range_T> signal_it)
 {
     bind(signal_it);
 
     return;
 }
 
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename signal_range_T, typename signal_T>
+void sc_map_base<range_T, object_T>::bind(
+        const sc_map_view<signal_range_T, signal_T>& signal_view)
+{
+    SC_MAP_PROFILE(name(), "bind(view)");
+
+    bind(signal_view.begin());
+
+    return;
+}
+
 //******************************************************************************
 template <typename range_T, typename object_T>
 template <typename data_type>
@@ -398,6 +687,105 @@ void sc_map_base<range_T, object_T>::write(const data_type& value)
     return;
 }
 
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename data_type>
+void sc_map_base<range_T, object_T>::write_all(
+        const std::vector<data_type>& values)
+{
+    begin().write_all(values);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_base<range_T, object_T>::write_bits(const sc_bv_base& bits)
+{
+    sc_map_write_bits(*this, bits);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename data_type>
+void sc_map_base<range_T, object_T>::read_all(std::vector<data_type>& values)
+{
+    begin().read_all(values);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_base<range_T, object_T>::read_bits(sc_bv_base& bits)
+{
+    sc_map_read_bits(*this, bits);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_write_bits(sc_map_base<range_T, object_T>& sc_map,
+        const sc_bv_base& bits)
+{
+    sc_map.begin().write_bits(bits);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_read_bits(sc_map_base<range_T, object_T>& sc_map, sc_bv_base& bits)
+{
+    sc_map.begin().read_bits(bits);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+const sc_event& sc_map_base<range_T, object_T>::changed_event()
+{
+    return get_change_monitor().changed_event();
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+const typename sc_map_base<range_T, object_T>::key_vector_type&
+        sc_map_base<range_T, object_T>::changed_keys()
+{
+    return get_change_monitor().changed_keys();
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_change_monitor<sc_map_base<range_T, object_T> >&
+        sc_map_base<range_T, object_T>::get_change_monitor()
+{
+    if (change_monitor == NULL)
+    {
+        change_monitor = new sc_map_change_monitor<sc_map_base<range_type, object_type> >(*this);
+    }
+
+    return *change_monitor;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_bus_trace<sc_map_base<range_T, object_T> >&
+        sc_map_base<range_T, object_T>::get_bus_trace()
+{
+    if (bus_trace == NULL)
+    {
+        bus_trace = new sc_map_bus_trace<sc_map_base<range_type, object_type> >(*this);
+    }
+
+    return *bus_trace;
+}
+
 //******************************************************************************
 template <typename range_T, typename object_T>
 const char* sc_map_base<range_T, object_T>::kind() const
@@ -434,16 +822,57 @@ template <typename trace_range_T, typename trace_object_T>
 void sc_trace(sc_trace_file* tf, sc_map_base<trace_range_T, trace_object_T>&
         sc_map, const std::string& name)
 {
-    for (typename sc_map_base<trace_range_T, trace_object_T>::iterator object_it = sc_map.begin();
-         object_it != sc_map.end();
-         ++object_it)
-    {
-        std::stringstream full_name;
-        full_name << name
-                  << sc_map::key_separator_char
-                  << object_it.get_key().second;
-        sc_trace(tf, *object_it, full_name.str().c_str());
-    }
+    SC_MAP_PROFILE(sc_map.name(), "sc_trace");
+
+    sc_map_trace_objects(tf, sc_map.begin(), sc_map.end(), name, sc_map_trace_all(), 1);
+
+    return;
+}
+
+//******************************************************************************
+template <typename trace_range_T, typename trace_object_T, typename other_range_T>
+void sc_trace(sc_trace_file* tf, sc_map_base<trace_range_T, trace_object_T>&
+        sc_map, const std::string& name, const other_range_T& range)
+{
+    SC_MAP_PROFILE(sc_map.name(), "sc_trace");
+
+    sc_map_trace_objects(tf, sc_map.begin(range), sc_map.end(), name, sc_map_trace_all(), 1);
+
+    return;
+}
+
+//******************************************************************************
+template <typename trace_range_T, typename trace_object_T, typename predicate_T>
+void sc_trace_if(sc_trace_file* tf, sc_map_base<trace_range_T, trace_object_T>&
+        sc_map, const std::string& name, const predicate_T& predicate)
+{
+    SC_MAP_PROFILE(sc_map.name(), "sc_trace_if");
+
+    sc_map_trace_objects(tf, sc_map.begin(), sc_map.end(), name, predicate, 1);
+
+    return;
+}
+
+//******************************************************************************
+template <typename trace_range_T, typename trace_object_T>
+void sc_trace_sampled(sc_trace_file* tf, sc_map_base<trace_range_T, trace_object_T>&
+        sc_map, const std::string& name, const std::size_t interval)
+{
+    SC_MAP_PROFILE(sc_map.name(), "sc_trace_sampled");
+
+    sc_map_trace_objects(tf, sc_map.begin(), sc_map.end(), name, sc_map_trace_all(), interval);
+
+    return;
+}
+
+//******************************************************************************
+template <typename trace_range_T, typename trace_object_T>
+void sc_trace_bus(sc_trace_file* tf, sc_map_base<trace_range_T, trace_object_T>&
+        sc_map, const std::string& name)
+{
+    SC_MAP_PROFILE(sc_map.name(), "sc_trace_bus");
+
+    sc_trace(tf, sc_map.get_bus_trace().get_bits(), name);
 
     return;
 }
@@ -453,6 +882,8 @@ template <typename signal_range_T, typename signal_T>
 sc_sensitive& operator<< (sc_sensitive& sensitivity_list,
         sc_map_base<signal_range_T, signal_T>& signal_map)
 {
+    SC_MAP_PROFILE(signal_map.name(), "sensitive <<");
+
     for (typename sc_map_base<signal_range_T, signal_T>::iterator signal_it = signal_map.begin();
          signal_it != signal_map.end();
          ++signal_it
@@ -467,16 +898,11 @@ sc_sensitive& operator<< (sc_sensitive& sensitivity_list,
 //******************************************************************************
 template <typename range_T, typename object_T>
 typename sc_map_base<range_T, object_T>::object_type*
-        sc_map_base<range_T, object_T>::creator::operator() (
-        const sc_module_name name,
+        sc_map_base<range_T, object_T>::creator::operator() (void* memory,
+        const char* name,
         const sc_map_base<range_type, object_type>::key_type& id) const
 {
-    std::stringstream full_name;
-
-    full_name << name << sc_map::key_separator_char << id;
-
-    sc_map_base<range_T, object_T>::object_type* new_sc_object = new object_type(full_name.str().c_str());
-    //simulation_size.add_element(new_sc_object);
+    sc_map_base<range_T, object_T>::object_type* new_sc_object = new (memory) object_type(name);
 
     return (new_sc_object);
 }
@@ -485,17 +911,12 @@ typename sc_map_base<range_T, object_T>::object_type*
 template <typename range_T, typename object_T>
 template <typename config_T>
 typename sc_map_base<range_T, object_T>::object_type*
-        sc_map_base<range_T, object_T>::creator::operator() (
-        const sc_module_name name,
+        sc_map_base<range_T, object_T>::creator::operator() (void* memory,
+        const char* name,
         const sc_map_base<range_type, object_type>::key_type& id,
         const config_T& configuration) const
 {
-    std::stringstream full_name;
-
-    full_name << name << sc_map::key_separator_char << id;
-
-    sc_map_base<range_T, object_T>::object_type* new_sc_object = new object_type(full_name.str().c_str(), configuration);
-    //simulation_size.add_element(new_sc_object);
+    sc_map_base<range_T, object_T>::object_type* new_sc_object = new (memory) object_type(name, configuration);
 
     return (new_sc_object);
 }
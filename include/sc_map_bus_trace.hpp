@@ -0,0 +1,146 @@
+/*!
+ * @file sc_map_bus_trace.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Packing of the bool signals of an sc_map container into a bit vector
+ *        for tracing.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include <systemc.h>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+//******************************************************************************
+
+/*!
+ * @brief Keeps the values of the bool signals of a container packed in a bit
+ *        vector, which can be traced as a single entry.
+ *
+ * A single method process is spawned, which is sensitive to the
+ * value_changed_event() of all signals of the container. It reads the
+ * signals into the bit vector with read_bits(), i.e. the first signal of the
+ * container is stored in bit 0. The process is also run at the start of the
+ * simulation, so that the bit vector holds the initial values of the signals.
+ *
+ * The process cannot tell which signals changed, so in each delta cycle with
+ * a change all N signals of the container are read again, i.e. the packing
+ * costs O(N) reads per delta cycle, independent of the number of changes.
+ * Only the stores into the bit vector are done a word at a time.
+ *
+ * The bus has to be created during elaboration and only works for containers
+ * of channels, as ports provide their events only after binding.
+ *
+ * @tparam sc_map_T Type of the packed container.
+ */
+template <typename sc_map_T>
+class sc_map_bus_trace
+{
+public:
+    typedef sc_map_T map_type;
+    typedef typename map_type::iterator iterator;
+    typedef typename map_type::object_type object_type;
+
+    /*!
+     * @brief Constructor: Spawns the process that packs the signals of the
+     *        container.
+     */
+    sc_map_bus_trace(map_type& signal_map);
+
+    /*!
+     * @brief Returns the bit vector with the current values of the signals.
+     */
+    const sc_bv_base& get_bits() const;
+
+private:
+    /*!
+     * @brief Function object of the process that packs the signals.
+     */
+    class packer
+    {
+    public:
+        packer(sc_map_bus_trace* bus);
+        void operator()();
+
+    private:
+        sc_map_bus_trace* bus;
+    };
+
+    map_type* map;
+    sc_bv_base bits;
+
+    void pack();
+
+    sc_map_bus_trace(const sc_map_bus_trace&);
+    sc_map_bus_trace& operator=(const sc_map_bus_trace&);
+};
+
+//******************************************************************************
+
+//******************************************************************************
+template <typename sc_map_T>
+sc_map_bus_trace<sc_map_T>::sc_map_bus_trace(map_type& signal_map) :
+        map(&signal_map),
+        bits(static_cast<int>(signal_map.objects.size()))
+{
+    static_assert(std::is_same<typename std::decay<decltype(
+            std::declval<object_type&>().read())>::type, bool>::value,
+            "sc_map_bus_trace needs a container of bool signals");
+
+    sc_spawn_options options;
+    options.spawn_method();
+
+    for (iterator signal_it = signal_map.begin();
+         signal_it != signal_map.end();
+         ++signal_it)
+    {
+        options.set_sensitivity(&signal_it->value_changed_event());
+    }
+
+    std::string process_name = signal_map.basename();
+    process_name += "_bus";
+
+    sc_spawn(packer(this), process_name.c_str(), &options);
+
+    return;
+}
+
+//******************************************************************************
+template <typename sc_map_T>
+const sc_bv_base& sc_map_bus_trace<sc_map_T>::get_bits() const
+{
+    return bits;
+}
+
+//******************************************************************************
+template <typename sc_map_T>
+void sc_map_bus_trace<sc_map_T>::pack()
+{
+    map->read_bits(bits);
+
+    return;
+}
+
+//******************************************************************************
+template <typename sc_map_T>
+sc_map_bus_trace<sc_map_T>::packer::packer(sc_map_bus_trace* bus) :
+        bus(bus)
+{}
+
+//******************************************************************************
+template <typename sc_map_T>
+void sc_map_bus_trace<sc_map_T>::packer::operator()()
+{
+    bus->pack();
+
+    return;
+}
@@ -0,0 +1,197 @@
+/*!
+ * @file sc_map_change_monitor.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Aggregated change event of the signals within an sc_map container.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_config.hpp"
+
+#include <systemc.h>
+
+#include <vector>
+#include <string>
+
+//******************************************************************************
+
+/*!
+ * @brief Collects the keys of the signals of a container that changed their
+ *        value and notifies a single event for them.
+ *
+ * For every signal a method process is spawned, which is sensitive to the
+ * value_changed_event() of the signal. It adds the key of the signal to the
+ * list of the current delta cycle and notifies changed_event() with a delta
+ * delay. A process that waits on changed_event() is therefore woken once per
+ * delta cycle with changes, one delta cycle after the signals changed, and
+ * gets the keys of exactly these signals from changed_keys().
+ *
+ * The monitor has to be created during elaboration and only works for
+ * containers of channels, as ports provide their events only after binding.
+ * It adds one process per signal to the simulation, i.e. N processes for a
+ * container of N signals, which are all spawned by the constructor.
+ *
+ * @tparam sc_map_T Type of the monitored container.
+ */
+template <typename sc_map_T>
+class sc_map_change_monitor
+{
+public:
+    typedef sc_map_T map_type;
+    typedef typename map_type::key_type key_type;
+    typedef typename map_type::key_vector_type key_vector_type;
+    typedef typename map_type::iterator iterator;
+
+    /*!
+     * @brief Constructor: Spawns the processes that observe the signals of
+     *        the container.
+     */
+    sc_map_change_monitor(map_type& signal_map);
+
+    /*!
+     * @brief Event that is notified one delta cycle after one or more signals
+     *        of the container changed.
+     */
+    const sc_event& changed_event() const;
+
+    /*!
+     * @brief Returns the keys of the signals that caused the current
+     *        notification of changed_event(), i.e. the keys of the signals
+     *        that changed in the previous delta cycle.
+     */
+    const key_vector_type& changed_keys() const;
+
+private:
+    /*!
+     * @brief Function object of the process that observes one signal.
+     */
+    class watcher
+    {
+    public:
+        watcher(sc_map_change_monitor* monitor, const key_type& key);
+        void operator()();
+
+    private:
+        sc_map_change_monitor* monitor;
+        key_type key;
+    };
+
+    sc_event event;
+
+    key_vector_type recording_keys;
+    sc_dt::uint64 recording_delta;
+    key_vector_type published_keys;
+    sc_dt::uint64 published_delta;
+    key_vector_type no_keys;
+
+    void record(const key_type& key);
+
+    sc_map_change_monitor(const sc_map_change_monitor&);
+    sc_map_change_monitor& operator=(const sc_map_change_monitor&);
+};
+
+//******************************************************************************
+
+//******************************************************************************
+template <typename sc_map_T>
+sc_map_change_monitor<sc_map_T>::sc_map_change_monitor(map_type& signal_map) :
+        recording_delta(~static_cast<sc_dt::uint64>(0)),
+        published_delta(~static_cast<sc_dt::uint64>(0))
+{
+    // The processes are named after the keys, as the objects of the
+    // container, e.g. the proxies of sc_map_packed_bool, need not have names.
+    std::string process_name = signal_map.basename();
+    process_name += sc_map::key_separator_char;
+    const std::string::size_type prefix_size = process_name.size();
+
+    for (iterator signal_it = signal_map.begin();
+         signal_it != signal_map.end();
+         ++signal_it)
+    {
+        process_name.resize(prefix_size);
+        signal_it.get_position().append_string(process_name);
+        process_name += "_changed";
+
+        sc_spawn_options options;
+        options.spawn_method();
+        options.dont_initialize();
+        options.set_sensitivity(&signal_it->value_changed_event());
+
+        sc_spawn(watcher(this, signal_it.get_position()), process_name.c_str(), &options);
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <typename sc_map_T>
+const sc_event& sc_map_change_monitor<sc_map_T>::changed_event() const
+{
+    return event;
+}
+
+//******************************************************************************
+template <typename sc_map_T>
+const typename sc_map_change_monitor<sc_map_T>::key_vector_type&
+        sc_map_change_monitor<sc_map_T>::changed_keys() const
+{
+    sc_dt::uint64 delta = sc_delta_count();
+
+    if (recording_delta + 1 == delta)
+    {
+        return recording_keys;
+    }
+    if (published_delta + 1 == delta)
+    {
+        return published_keys;
+    }
+
+    return no_keys;
+}
+
+//******************************************************************************
+template <typename sc_map_T>
+void sc_map_change_monitor<sc_map_T>::record(const key_type& key)
+{
+    sc_dt::uint64 delta = sc_delta_count();
+
+    // The first change of a delta cycle publishes the keys of the previous
+    // one, which are read by the processes woken in this delta cycle.
+    if (recording_delta != delta)
+    {
+        published_keys.swap(recording_keys);
+        published_delta = recording_delta;
+        recording_keys.clear();
+        recording_delta = delta;
+
+        event.notify(SC_ZERO_TIME);
+    }
+
+    recording_keys.push_back(key);
+
+    return;
+}
+
+//******************************************************************************
+template <typename sc_map_T>
+sc_map_change_monitor<sc_map_T>::watcher::watcher(
+        sc_map_change_monitor* monitor, const key_type& key) :
+        monitor(monitor),
+        key(key)
+{}
+
+//******************************************************************************
+template <typename sc_map_T>
+void sc_map_change_monitor<sc_map_T>::watcher::operator()()
+{
+    monitor->record(key);
+
+    return;
+}
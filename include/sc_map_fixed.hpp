@@ -0,0 +1,116 @@
+/*!
+ * @file sc_map_fixed.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Container for regular structures whose extents are template
+ *        parameters.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_base.hpp"
+#include <systemc.h>
+
+#include "sc_map_nd_key.hpp"
+#include "sc_map_fixed_range.hpp"
+
+//******************************************************************************
+
+/*!
+ * @brief Container for a regular structure with a shape that is fixed at
+ *        compile time.
+ *
+ * E.g. sc_map_fixed<sc_signal<bool>, 4, 4> is a 4x4 array with the keys
+ * sc_map_nd_key<2>(0,0) to sc_map_nd_key<2>(3,3). Sizes and strides are
+ * compile-time constants, so lookups reduce to constant offsets into the
+ * dense storage. With at<Y, X>() the indexes are also checked at compile
+ * time.
+ *
+ * @tparam object_T Type of the objects in the container.
+ * @tparam extents Number of elements in each dimension.
+ */
+template <typename object_T, std::size_t... extents>
+class sc_map_fixed : public sc_map_base<sc_map_fixed_range<extents...>, object_T>
+{
+public:
+    typedef sc_map_base<sc_map_fixed_range<extents...>, object_T> base;
+    typedef typename base::range_type range_type;
+    typedef typename base::key_type key_type;
+    typedef typename base::key_vector_type key_vector_type;
+    typedef typename base::key_type::index_type index_type;
+    typedef typename base::size_type size_type;
+    typedef typename range_type::shape shape;
+
+    static const unsigned int dimensions = sizeof...(extents);
+    static const size_type element_cnt = shape::size;
+
+    sc_map_fixed(const sc_module_name name);
+    template <typename config_type>
+    sc_map_fixed(const sc_module_name name, const config_type& configuration);
+
+    virtual ~sc_map_fixed() {};
+
+    using base::at;
+    template <typename... index_T>
+    object_T& at(const index_T... indexes);
+    template <std::size_t... indexes>
+    object_T& at();
+
+    const char* kind() const;
+};
+
+//******************************************************************************
+
+//******************************************************************************
+template <typename object_T, std::size_t... extents>
+sc_map_fixed<object_T, extents...>::sc_map_fixed(const sc_module_name name) :
+        base(name)
+{
+    this->init(range_type(), typename base::creator());
+
+    return;
+}
+
+//******************************************************************************
+template <typename object_T, std::size_t... extents>
+template <typename config_type>
+sc_map_fixed<object_T, extents...>::sc_map_fixed(const sc_module_name name,
+        const config_type& configuration) :
+        base(name)
+{
+    this->init(range_type(), typename base::creator(), configuration);
+
+    return;
+}
+
+//******************************************************************************
+template <typename object_T, std::size_t... extents>
+template <typename... index_T>
+inline object_T& sc_map_fixed<object_T, extents...>::at(const index_T... indexes)
+{
+    return base::at(key_type(indexes...));
+}
+
+//******************************************************************************
+template <typename object_T, std::size_t... extents>
+template <std::size_t... indexes>
+inline object_T& sc_map_fixed<object_T, extents...>::at()
+{
+    static_assert(sizeof...(indexes) == sizeof...(extents), "sc_map_fixed::at() needs one index per dimension");
+    static_assert(shape::in_range(indexes...), "sc_map_fixed::at() index out of range");
+
+    return base::at(key_type(indexes...));
+}
+
+//******************************************************************************
+template <typename object_T, std::size_t... extents>
+const char* sc_map_fixed<object_T, extents...>::kind() const
+{
+    return ("sc_map_fixed");
+}
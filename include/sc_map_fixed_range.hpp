@@ -0,0 +1,522 @@
+/*!
+ * @file sc_map_fixed_range.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Range of regular structures whose extents are template parameters.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_regular_range.hpp"
+#include "sc_map_nd_key.hpp"
+
+#include <systemc.h>
+
+#include <string>
+#include <cstddef>
+
+//******************************************************************************
+
+/*!
+ * @brief Shape of a box of keys with extents known at compile time.
+ *
+ * Sizes, extents and strides are compile-time constants. The functions
+ * recurse over the dimensions, so that a storage offset compiles to a sum of
+ * products with constant strides, or to a single constant if the indexes are
+ * constant, and a step through a box compiles to nested comparisons without a
+ * loop over the dimensions.
+ *
+ * @tparam extents Number of elements in each dimension, the first one is the
+ *         most significant.
+ */
+template <std::size_t... extents>
+struct sc_map_fixed_shape;
+
+//******************************************************************************
+template <>
+struct sc_map_fixed_shape<>
+{
+    static constexpr std::size_t size = 1;
+
+    static constexpr std::size_t extent_of(const unsigned int dim)
+    {
+        return 1;
+    }
+
+    static constexpr std::size_t stride_of(const unsigned int dim)
+    {
+        return 1;
+    }
+
+    static constexpr bool in_range()
+    {
+        return true;
+    }
+
+    static constexpr std::size_t offset_of()
+    {
+        return 0;
+    }
+
+    template <unsigned int dim, typename key_T>
+    static bool offset(const key_T& key, std::size_t& offset)
+    {
+        return true;
+    }
+
+    template <unsigned int dim, typename key_T>
+    static void key_of(const std::size_t offset, key_T& key)
+    {}
+
+    template <unsigned int dim, typename key_T>
+    static void last_key(key_T& key)
+    {}
+
+    template <unsigned int dim, typename key_T>
+    static bool next_key(const key_T& start_key, const key_T& end_key, key_T& key)
+    {
+        return false;
+    }
+
+    template <unsigned int dim, typename key_T>
+    static void reset(const key_T& start_key, key_T& key)
+    {}
+
+    template <unsigned int dim, typename key_T>
+    static std::size_t box_size(const key_T& start_key, const key_T& end_key)
+    {
+        return 1;
+    }
+
+    template <unsigned int dim, typename key_T>
+    static bool box_index(const key_T& start_key, const key_T& end_key, const key_T& key, std::size_t& index)
+    {
+        return true;
+    }
+
+    template <unsigned int dim, typename key_T>
+    static void box_key(const key_T& start_key, const key_T& end_key, std::size_t& index, key_T& key)
+    {}
+};
+
+//******************************************************************************
+template <std::size_t extent, std::size_t... inner_extents>
+struct sc_map_fixed_shape<extent, inner_extents...>
+{
+    static_assert(extent > 0, "sc_map_fixed_shape needs at least one element per dimension");
+
+    typedef sc_map_fixed_shape<inner_extents...> inner;
+
+    static constexpr std::size_t size = extent * inner::size;
+    static constexpr std::size_t stride = inner::size;
+
+    /*!
+     * @brief Returns the extent and the stride of a dimension.
+     */
+    static constexpr std::size_t extent_of(const unsigned int dim)
+    {
+        return (dim == 0) ? extent : inner::extent_of(dim - 1);
+    }
+
+    static constexpr std::size_t stride_of(const unsigned int dim)
+    {
+        return (dim == 0) ? stride : inner::stride_of(dim - 1);
+    }
+
+    /*!
+     * @brief Checks at compile time if the indexes lie within the shape.
+     */
+    template <typename... index_T>
+    static constexpr bool in_range(const std::size_t index, const index_T... inner_indexes)
+    {
+        return (index < extent) && inner::in_range(inner_indexes...);
+    }
+
+    /*!
+     * @brief Calculates the storage offset of the indexes at compile time.
+     */
+    template <typename... index_T>
+    static constexpr std::size_t offset_of(const std::size_t index, const index_T... inner_indexes)
+    {
+        return index * stride + inner::offset_of(inner_indexes...);
+    }
+
+    template <unsigned int dim, typename key_T>
+    static bool offset(const key_T& key, std::size_t& offset)
+    {
+        std::size_t dim_index = key[dim];
+        if (dim_index >= extent)
+        {
+            return false;
+        }
+        offset += dim_index * stride;
+
+        return inner::template offset<dim+1>(key, offset);
+    }
+
+    template <unsigned int dim, typename key_T>
+    static void key_of(const std::size_t offset, key_T& key)
+    {
+        key.set(dim, static_cast<typename key_T::index_type>((offset / stride) % extent));
+        inner::template key_of<dim+1>(offset, key);
+
+        return;
+    }
+
+    template <unsigned int dim, typename key_T>
+    static void last_key(key_T& key)
+    {
+        key.set(dim, static_cast<typename key_T::index_type>(extent - 1));
+        inner::template last_key<dim+1>(key);
+
+        return;
+    }
+
+    /*!
+     * @brief Steps key to the next key of the box from start_key to end_key,
+     *        the last dimension changes fastest.
+     */
+    template <unsigned int dim, typename key_T>
+    static bool next_key(const key_T& start_key, const key_T& end_key, key_T& key)
+    {
+        if (inner::template next_key<dim+1>(start_key, end_key, key))
+        {
+            return true;
+        }
+
+        if (key[dim] == end_key[dim])
+        {
+            return false;
+        }
+
+        key.set(dim, key[dim] + ((start_key[dim] <= end_key[dim]) ? 1 : -1));
+        inner::template reset<dim+1>(start_key, key);
+
+        return true;
+    }
+
+    template <unsigned int dim, typename key_T>
+    static void reset(const key_T& start_key, key_T& key)
+    {
+        key.set(dim, start_key[dim]);
+        inner::template reset<dim+1>(start_key, key);
+
+        return;
+    }
+
+    template <unsigned int dim, typename key_T>
+    static std::size_t box_size(const key_T& start_key, const key_T& end_key)
+    {
+        return dim_size(start_key[dim], end_key[dim])
+                * inner::template box_size<dim+1>(start_key, end_key);
+    }
+
+    /*!
+     * @brief Calculates the position of key in the order of next_key().
+     */
+    template <unsigned int dim, typename key_T>
+    static bool box_index(const key_T& start_key, const key_T& end_key,
+            const key_T& key, std::size_t& index)
+    {
+        std::size_t dim_index;
+        if (start_key[dim] <= end_key[dim])
+        {
+            dim_index = key[dim] - start_key[dim];
+        }
+        else
+        {
+            dim_index = start_key[dim] - key[dim];
+        }
+
+        if (dim_index >= dim_size(start_key[dim], end_key[dim]))
+        {
+            return false;
+        }
+        index = index * dim_size(start_key[dim], end_key[dim]) + dim_index;
+
+        return inner::template box_index<dim+1>(start_key, end_key, key, index);
+    }
+
+    /*!
+     * @brief Calculates the key at a position in the order of next_key(),
+     *        the position is consumed from the last dimension on.
+     */
+    template <unsigned int dim, typename key_T>
+    static void box_key(const key_T& start_key, const key_T& end_key,
+            std::size_t& index, key_T& key)
+    {
+        inner::template box_key<dim+1>(start_key, end_key, index, key);
+
+        const std::size_t dim_extent = dim_size(start_key[dim], end_key[dim]);
+        const typename key_T::index_type dim_index =
+                static_cast<typename key_T::index_type>(index % dim_extent);
+        index /= dim_extent;
+
+        if (start_key[dim] <= end_key[dim])
+        {
+            key.set(dim, start_key[dim] + dim_index);
+        }
+        else
+        {
+            key.set(dim, start_key[dim] - dim_index);
+        }
+
+        return;
+    }
+
+    template <typename index_T>
+    static std::size_t dim_size(const index_T start_index, const index_T end_index)
+    {
+        return (start_index <= end_index) ? (end_index - start_index + 1) : (start_index - end_index + 1);
+    }
+};
+
+//******************************************************************************
+
+/*!
+ * @brief Range of a container with fixed extents, which starts at index 0 in
+ *        every dimension.
+ *
+ * The range keeps only its start and end key, extents and strides are taken
+ * from sc_map_fixed_shape. Traversal, size() and the mapping of the keys to
+ * the dense storage are unrolled over the dimensions at compile time. A range
+ * over the whole shape has element_cnt keys. Sub-ranges of any box within the
+ * shape, in either direction, are used for iterators and views.
+ *
+ * @tparam extents Number of elements in each dimension.
+ */
+template <std::size_t... extents>
+class sc_map_fixed_range : public sc_map_regular_range<sc_map_nd_key<sizeof...(extents)> >
+{
+public:
+    typedef sc_map_regular_range<sc_map_nd_key<sizeof...(extents)> > base;
+    typedef typename base::key_type key_type;
+    typedef typename key_type::index_type index_type;
+    typedef sc_map_fixed_shape<extents...> shape;
+
+    static const unsigned int dimensions = sizeof...(extents);
+    static constexpr std::size_t element_cnt = shape::size;
+
+    /*!
+     * @brief Constructor: Range over all elements of the shape.
+     */
+    sc_map_fixed_range();
+    sc_map_fixed_range(const key_type& start_key, const key_type& end_key);
+
+    /*!
+     * @brief Constructor: Creates a sub-range of another range.
+     *
+     * Reports an error with SC_REPORT_ERROR if start_key or end_key lie
+     * outside of base_range.
+     */
+    sc_map_fixed_range(const sc_map_range<key_type>* base_range, const key_type& start_key, const key_type& end_key);
+    virtual ~sc_map_fixed_range() {};
+
+    virtual sc_map_fixed_range* clone() const;
+
+    virtual bool next_key(key_type& key) const;
+
+    virtual std::size_t size() const;
+    virtual bool key_in_range(const key_type& key) const;
+
+    /*!
+     * @brief Calculates the position of a key in the order given by
+     *        next_key(), start_key is at position 0.
+     */
+    bool index_of(const key_type& key, std::size_t& index) const;
+    key_type key_at(const std::size_t index) const;
+
+    /*!
+     * @brief Calculates the key that lies at an offset from another key, see
+     *        sc_map_nd_range::shifted_key().
+     */
+    bool shifted_key(const key_type& key, const key_type& offset, const bool wrap, key_type& shifted) const;
+
+    static constexpr std::size_t extent(const unsigned int dim);
+    static constexpr std::size_t stride(const unsigned int dim);
+
+    static constexpr std::size_t storage_size();
+    bool storage_offset(const key_type& key, std::size_t& offset) const;
+    key_type storage_key(const std::size_t offset) const;
+
+    static key_type full_last_key();
+};
+
+//******************************************************************************
+
+//******************************************************************************
+template <std::size_t... extents>
+sc_map_fixed_range<extents...>::sc_map_fixed_range() :
+        base(key_type(), full_last_key())
+{}
+
+//******************************************************************************
+template <std::size_t... extents>
+sc_map_fixed_range<extents...>::sc_map_fixed_range(const key_type& start_key,
+        const key_type& end_key) :
+        base(start_key, end_key)
+{}
+
+//******************************************************************************
+template <std::size_t... extents>
+sc_map_fixed_range<extents...>::sc_map_fixed_range(
+        const sc_map_range<key_type>* base_range, const key_type& start_key,
+        const key_type& end_key) :
+        base(start_key, end_key)
+{
+    if ((base_range != NULL) &&
+        (!base_range->key_in_range(start_key) || !base_range->key_in_range(end_key)))
+    {
+        std::string message = "sub-range ";
+        start_key.append_string(message);
+        message += " to ";
+        end_key.append_string(message);
+        message += " is outside of the base range";
+        SC_REPORT_ERROR("sc_map_fixed_range", message.c_str());
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+sc_map_fixed_range<extents...>* sc_map_fixed_range<extents...>::clone() const
+{
+    return new sc_map_fixed_range(*this);
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+inline bool sc_map_fixed_range<extents...>::next_key(key_type& key) const
+{
+    return shape::template next_key<0>(this->start_key, this->end_key, key);
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+std::size_t sc_map_fixed_range<extents...>::size() const
+{
+    return shape::template box_size<0>(this->start_key, this->end_key);
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+bool sc_map_fixed_range<extents...>::key_in_range(const key_type& key) const
+{
+    std::size_t index;
+
+    return index_of(key, index);
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+inline bool sc_map_fixed_range<extents...>::index_of(const key_type& key,
+        std::size_t& index) const
+{
+    index = 0;
+
+    return shape::template box_index<0>(this->start_key, this->end_key, key, index);
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+inline typename sc_map_fixed_range<extents...>::key_type
+        sc_map_fixed_range<extents...>::key_at(const std::size_t index) const
+{
+    key_type key;
+    std::size_t remaining = index;
+    shape::template box_key<0>(this->start_key, this->end_key, remaining, key);
+
+    return key;
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+bool sc_map_fixed_range<extents...>::shifted_key(const key_type& key,
+        const key_type& offset, const bool wrap, key_type& shifted) const
+{
+    shifted = key;
+
+    for (unsigned int dim = 0; dim < dimensions; ++dim)
+    {
+        const index_type low = (this->start_key[dim] <= this->end_key[dim]) ? this->start_key[dim] : this->end_key[dim];
+        const index_type dim_extent = static_cast<index_type>(shape::dim_size(this->start_key[dim], this->end_key[dim]));
+        index_type dim_offset = key[dim] + offset[dim] - low;
+
+        if (wrap)
+        {
+            dim_offset %= dim_extent;
+            if (dim_offset < 0)
+            {
+                dim_offset += dim_extent;
+            }
+        }
+        else if ((dim_offset < 0) || (dim_offset >= dim_extent))
+        {
+            return false;
+        }
+
+        shifted.set(dim, low + dim_offset);
+    }
+
+    return true;
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+constexpr std::size_t sc_map_fixed_range<extents...>::extent(const unsigned int dim)
+{
+    return shape::extent_of(dim);
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+constexpr std::size_t sc_map_fixed_range<extents...>::stride(const unsigned int dim)
+{
+    return shape::stride_of(dim);
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+constexpr std::size_t sc_map_fixed_range<extents...>::storage_size()
+{
+    return shape::size;
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+inline bool sc_map_fixed_range<extents...>::storage_offset(
+        const key_type& key, std::size_t& offset) const
+{
+    offset = 0;
+
+    return shape::template offset<0>(key, offset);
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+inline typename sc_map_fixed_range<extents...>::key_type
+        sc_map_fixed_range<extents...>::storage_key(const std::size_t offset) const
+{
+    key_type key;
+    shape::template key_of<0>(offset, key);
+
+    return key;
+}
+
+//******************************************************************************
+template <std::size_t... extents>
+typename sc_map_fixed_range<extents...>::key_type
+        sc_map_fixed_range<extents...>::full_last_key()
+{
+    key_type key;
+    shape::template last_key<0>(key);
+
+    return key;
+}
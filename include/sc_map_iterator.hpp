@@ -12,10 +12,17 @@
 
 #include "sc_map_range.hpp"
 
+#include "sc_map_profiler.hpp"
+
+#ifdef SC_MAP_SIZE_ANALYZER
+    #include "size_analyzer.hpp"
+#endif
+
 #include <systemc.h>
 
 #include <iterator>
 #include <utility>
+#include <vector>
 
 
 template <typename range_T, typename object_T>
@@ -27,13 +34,24 @@ class sc_map_base;
  * @brief Iterator for the sc_map containers.
  *
  * The direction in which the iterator goes over the elements of a container is
- * defined by the range.
+ * defined by the range. The range is held by value, so creating, copying,
+ * comparing and incrementing an iterator does not allocate memory. The end
+ * iterator is a sentinel that only carries the end flag.
+ *
+ * The range type defaults to the range type of the container. Other range
+ * types with the same key type, e.g. sc_map_strided_range, select a subset of
+ * the elements or another order. Iterators with different range types on the
+ * same container can be compared, e.g. with the end() of the container.
  *
  * @tparam sc_map_T container type to iterate over.
+ * @tparam range_T range type that defines the iterated keys.
  */
-template <typename sc_map_T>
+template <typename sc_map_T, typename range_T = typename sc_map_T::range_type>
 class sc_map_iterator : public std::iterator<std::forward_iterator_tag, typename sc_map_T::object_type>
 {
+    template <typename other_map_T, typename other_range_T>
+    friend class sc_map_iterator;
+
 public:
     /*!
     * @brief Type of the sc_map container.
@@ -52,6 +70,11 @@ public:
     */
     typedef typename map_type::key_type key_type;
 
+    /*!
+    * @brief Type of the range over which the iterator runs.
+    */
+    typedef range_T range_type;
+
     /*!
     * @brief Type of the flag signalling that the end of the container has been
     *        reached.
@@ -68,7 +91,7 @@ public:
     * @brief Constructor: Creates an iterator that covers the whole range of a
     *        provided sc_map container.
     *
-    * Clones the range of the provided container and sets the pointer to the
+    * Copies the range of the provided container and sets the pointer to the
     * first element.
     *
     * @param sc_map Pointer to the sc_map container on which the iterator works.
@@ -79,7 +102,9 @@ public:
     * @brief Constructor: Creates iterator that runs over the whole range of a
     *        provided container. Sets end_flag to specific value.
     *
-    * Clones the range of the provided container and sets the pointer to the
+    * If end_id is set to end, the range is not copied and the iterator
+    * serves as a cheap sentinel for the end of the container. Otherwise, the
+    * range of the provided container is copied and the pointer is set to the
     * first element.
     *
     * @param sc_map Pointer to the sc_map container on which the iterator works.
@@ -92,7 +117,7 @@ public:
     *        provided container. Sets the initial element to which the iterator
     *        points.
     *
-    * Clones the range of the provided container.
+    * Copies the range of the provided container.
     *
     * @param sc_map Pointer to the sc_map container on which the iterator works.
     * @param map_pos Position within the container to which the iterator should
@@ -111,7 +136,7 @@ public:
     * @param range Range which defines the part of the container over which it
     *        iterates.
     */
-    sc_map_iterator(sc_map_T* sc_map, const sc_map_range<key_type>& range);
+    sc_map_iterator(sc_map_T* sc_map, const range_type& range);
 
     /*!
     * @brief Constructor: Creates iterator that runs over a specfified range of
@@ -126,7 +151,7 @@ public:
     * @param map_pos Position within the container to which the iterator should
     *        point initially.
     */
-    sc_map_iterator(sc_map_T* sc_map, const sc_map_range<key_type>& range, const key_type& map_pos);
+    sc_map_iterator(sc_map_T* sc_map, const range_type& range, const key_type& map_pos);
 
     /*!
     * @brief Constructor: Creates iterator that runs between two defined keys of
@@ -141,34 +166,6 @@ public:
     */
     sc_map_iterator(sc_map_T* sc_map, const key_type& start_key, const key_type& end_key);
 
-    /*!
-    * @brief Copy Constructor:
-    *
-    * Copies the member of the iterator. For the range it generates a new range
-    * based on the range of the original iterator.
-    *
-    * @param original Iterator which values are copied to the new iterator.
-    */
-    sc_map_iterator(const sc_map_iterator& original);
-
-    /*!
-    * @brief Destructor:
-    *
-    * Frees the memory of the range that belong to the iterator.
-    */
-    virtual ~sc_map_iterator();
-
-    /*!
-    * @brief Assignment operator
-    *
-    * Creates an exact copy, i.e. the same range is used as by the original
-    * iterator.
-    *
-    * @param rhs Original iterator.
-    * @return reference to this iterator.
-    */
-    sc_map_iterator& operator= (const sc_map_iterator& rhs);
-
     /*!
     * @brief Check if two iterators point to the same element
     *
@@ -178,7 +175,8 @@ public:
     * @param other Second iterator to compare with.
     * @return true if both iterators point to the same element
     */
-    bool operator==(const sc_map_iterator& other) const;
+    template <typename other_range_T>
+    bool operator==(const sc_map_iterator<sc_map_T, other_range_T>& other) const;
 
     /*!
     * @brief Check if two iterators point to a different element
@@ -188,7 +186,8 @@ public:
     * @param other Second iterator to compare with.
     * @return true if both iterators point to a different element
     */
-    bool operator!=(const sc_map_iterator& other) const;
+    template <typename other_range_T>
+    bool operator!=(const sc_map_iterator<sc_map_T, other_range_T>& other) const;
 
     /*!
     * @brief Moves iterator to the next element of the container.
@@ -198,21 +197,21 @@ public:
     *
     * @return A reference to the iterator.
     */
-    virtual sc_map_iterator& operator++();
+    sc_map_iterator& operator++();
 
     /*!
     * @brief Gets the reference to the object the iterator actually points to.
     *
     * @return A reference to the object to which the iterator points.
     */
-    virtual object_type& operator*();
+    object_type& operator*();
 
     /*!
     * @brief Allows to access members of an object to which the iterator points.
     *
     * @return A pointer to the object to which the iterator points.
     */
-    virtual object_type* operator->();
+    object_type* operator->();
 
     /*!
     * @brief Writes a value to all SystemC objects which belong to the
@@ -242,6 +241,62 @@ public:
     template<typename data_type>
     void operator= (const data_type& value);
 
+    /*!
+    * @brief Writes the values of an array to the SystemC objects which belong
+    *        to the iterator range.
+    *
+    * The values are assigned in the order of the range, starting with the
+    * object to which the iterator points. Every object is written, as a
+    * signal that keeps its value neither requests an update nor notifies an
+    * event. Writing stops at the end of the range or the array.
+    *
+    * @tparam data_type Data type of the values that are written. It does not
+    *         to be explicitly specified and can be derived from the function
+    *         call.
+    * @param values Values that are written to the signals.
+    */
+    template<typename data_type>
+    void write_all(const std::vector<data_type>& values);
+
+    /*!
+    * @brief Writes the bits of a bit vector to the SystemC objects which
+    *        belong to the iterator range.
+    *
+    * Bit 0 is written to the object to which the iterator points, the
+    * following bits in the order of the range.
+    *
+    * @param bits Bit vector with the values of the signals.
+    */
+    void write_bits(const sc_bv_base& bits);
+
+    /*!
+    * @brief Reads the values of the SystemC objects which belong to the
+    *        iterator range into an array.
+    *
+    * The values are stored in the order of the range, starting with the
+    * object to which the iterator points. The array is cleared before, its
+    * memory is reused.
+    *
+    * @tparam data_type Data type of the values that are read. It does not to
+    *         be explicitly specified and can be derived from the function
+    *         call.
+    * @param values Array that receives the values of the signals.
+    */
+    template<typename data_type>
+    void read_all(std::vector<data_type>& values);
+
+    /*!
+    * @brief Reads the values of the SystemC objects which belong to the
+    *        iterator range into a bit vector.
+    *
+    * The value of the object to which the iterator points is stored in bit 0,
+    * the following ones in the order of the range. Reading stops at the end of
+    * the range or the bit vector, bits without an object are cleared.
+    *
+    * @param bits Bit vector that receives the values of the signals.
+    */
+    void read_bits(sc_bv_base& bits);
+
     /*!
     * @brief Binds a SystemC signal to all SystemC objects which belong to the
     *        iterator range.
@@ -326,11 +381,12 @@ public:
     * @tparam signal_map_T Type of the sc_map wich is passed by the parameter to
     *         the iterator. It does not need to be explicitly specified and can
     *         be derived from the function call.
+    * @tparam signal_it_range_T Range type of the passed iterator.
     * @param signal_it The sc_map_iterator on a sc_map with signals whose
     *        signals are bound.
     */
-    template <typename signal_map_T>
-    void bind(sc_map_iterator<signal_map_T> signal_it);
+    template <typename signal_map_T, typename signal_it_range_T>
+    void bind(sc_map_iterator<signal_map_T, signal_it_range_T> signal_it);
 
     /*!
     * @brief Operator notation: Binds the sc_signal objects of another iterator
@@ -342,11 +398,12 @@ public:
     * @tparam signal_map_T Type of the sc_map wich is passed by the parameter to
     *         the iterator. It does not need to be explicitly specified and can
     *         be derived from the function call.
+    * @tparam signal_it_range_T Range type of the passed iterator.
     * @param signal_it The sc_map_iterator on a sc_map with signals whose
     *        signals are bound.
     */
-    template <typename signal_map_T>
-    void operator() (sc_map_iterator<signal_map_T> signal_it);
+    template <typename signal_map_T, typename signal_it_range_T>
+    void operator() (sc_map_iterator<signal_map_T, signal_it_range_T> signal_it);
 
     /*!
     * @brief Returns the key to which the iterator currently points.
@@ -357,6 +414,15 @@ public:
     */
     std::pair<end_type, key_type> get_key() const;
 
+    /*!
+    * @brief Returns a reference to the key to which the iterator currently
+    *        points, without copying it as get_key() does.
+    *
+    * The key is only meaningful as long as the end of the range is not
+    * reached.
+    */
+    const key_type& get_position() const;
+
 private:
     /*!
     * @brief Pointer to sc_map object to which the iterator belong.
@@ -364,9 +430,9 @@ private:
     map_type* map;
 
     /*!
-    * @brief Pointer to the range over which the iterator iterates.
+    * @brief The range over which the iterator iterates.
     */
-    sc_map_range<key_type>* range;
+    range_type range;
 
     /*!
     * @brief The position of the object to which the iterator currently points.
@@ -377,141 +443,135 @@ private:
     * @brief Flag that inidicates if the end of the range is reached.
     */
     end_type end_flag;
+
+    /*!
+    * @brief Reports the iterator to simulation_size, if SC_MAP_SIZE_ANALYZER
+    *        is defined.
+    *
+    * @param heap_bytes Memory allocated for the range of the iterator.
+    */
+    void count_iterator(const std::size_t heap_bytes) const;
 };
 
 //******************************************************************************
 
 //******************************************************************************
-template <typename sc_map_T>
-const typename sc_map_iterator<sc_map_T>::end_type
-        sc_map_iterator<sc_map_T>::end = true;
+template <typename sc_map_T, typename range_T>
+const typename sc_map_iterator<sc_map_T, range_T>::end_type
+        sc_map_iterator<sc_map_T, range_T>::end = true;
 
 //******************************************************************************
-template <typename sc_map_T>
-sc_map_iterator<sc_map_T>::sc_map_iterator(sc_map_T* sc_map) :
+template <typename sc_map_T, typename range_T>
+sc_map_iterator<sc_map_T, range_T>::sc_map_iterator(sc_map_T* sc_map) :
         map(sc_map),
-        end_flag(!end)
+        range(*map->get_range()),
+        position(range.first()),
+        end_flag(range.empty())
 {
-    range = map->get_range()->clone();
-    position = range->first();
+    count_iterator(0);
 
     return;
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-sc_map_iterator<sc_map_T>::sc_map_iterator(map_type* sc_map,
+template <typename sc_map_T, typename range_T>
+sc_map_iterator<sc_map_T, range_T>::sc_map_iterator(map_type* sc_map,
         const end_type end_id) :
         map(sc_map),
         end_flag(end_id)
 {
-    range = map->get_range()->clone();
-    position = range->first();
+    if (end_flag != end)
+    {
+        range = *map->get_range();
+        position = range.first();
+        end_flag = range.empty();
+    }
 
     return;
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-sc_map_iterator<sc_map_T>::sc_map_iterator(map_type* sc_map,
+template <typename sc_map_T, typename range_T>
+sc_map_iterator<sc_map_T, range_T>::sc_map_iterator(map_type* sc_map,
         const key_type& map_pos) :
         map(sc_map),
+        range(*map->get_range()),
         position(map_pos),
         end_flag(!end)
 {
     // todo: check if map_pos exists within container
 
-    range = map->get_range()->clone();
+    count_iterator(0);
 
     return;
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-sc_map_iterator<sc_map_T>::sc_map_iterator(map_type* sc_map,
-        const sc_map_range<key_type>& range) :
+template <typename sc_map_T, typename range_T>
+sc_map_iterator<sc_map_T, range_T>::sc_map_iterator(map_type* sc_map,
+        const range_type& range) :
         map(sc_map),
-        end_flag(!end)
+        range(range),
+        position(range.first()),
+        end_flag(range.empty())
 {
     // todo: check if range is compatible with container
 
-    this->range = range.clone();
-
-    position = this->range->first();
+    count_iterator(0);
 
     return;
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-sc_map_iterator<sc_map_T>::sc_map_iterator(map_type* sc_map,
-        const sc_map_range<key_type>& range, const key_type& map_pos) :
+template <typename sc_map_T, typename range_T>
+sc_map_iterator<sc_map_T, range_T>::sc_map_iterator(map_type* sc_map,
+        const range_type& range, const key_type& map_pos) :
         map(sc_map),
+        range(range),
+        position(map_pos),
         end_flag(!end)
 {
     // todo: check if range is compatible with container
     // todo: check if map_pos exists within container
 
-    this->range = range.clone();
-
-    position = map_pos;
+    count_iterator(0);
 
     return;
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-sc_map_iterator<sc_map_T>::sc_map_iterator(map_type* sc_map,
+template <typename sc_map_T, typename range_T>
+sc_map_iterator<sc_map_T, range_T>::sc_map_iterator(map_type* sc_map,
         const key_type& start_key, const key_type& end_key) :
         map(sc_map),
+        range(map->get_range(), start_key, end_key),
         position(start_key),
         end_flag(!end)
 {
     // todo: check if keys exist within container
 
-    range = new typename map_type::range_type(map->get_range(), start_key, end_key);
+    count_iterator(range.heap_size());
 
     return;
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-sc_map_iterator<sc_map_T>::sc_map_iterator(const sc_map_iterator& original)
+template <typename sc_map_T, typename range_T>
+inline void sc_map_iterator<sc_map_T, range_T>::count_iterator(
+        const std::size_t heap_bytes) const
 {
-    map = original.map;
-    typename map_type::range_type* original_range_ptr = static_cast<typename map_type::range_type*>(original.range);
-    range = new typename map_type::range_type(*original_range_ptr);
-    position = original.position;
-    end_flag = original.end_flag;
+#ifdef SC_MAP_SIZE_ANALYZER
+    simulation_size.add_iterator(map, heap_bytes);
+#endif
 
     return;
 }
 
-//************************************************************ ******************
-template <typename sc_map_T>
-sc_map_iterator<sc_map_T>::~sc_map_iterator()
-{
-    delete range;
-
-    return;
-};
-
 //******************************************************************************
-template <typename sc_map_T>
-sc_map_iterator<sc_map_T>& sc_map_iterator<sc_map_T>::operator= (const sc_map_iterator& rhs)
-{
-    map = rhs.map;
-    *range = *(rhs.range);
-    position = rhs.position;
-    end_flag = rhs.end_flag;
-
-    return *this;
-}
-
-//******************************************************************************
-template <typename sc_map_T>
-bool sc_map_iterator<sc_map_T>::operator==(const sc_map_iterator& rhs)
-        const
+template <typename sc_map_T, typename range_T>
+template <typename other_range_T>
+bool sc_map_iterator<sc_map_T, range_T>::operator==(
+        const sc_map_iterator<sc_map_T, other_range_T>& rhs) const
 {
     bool equal = false;
 
@@ -523,8 +583,7 @@ bool sc_map_iterator<sc_map_T>::operator==(const sc_map_iterator& rhs)
         }
         else
         {
-            equal &= this->map == rhs.map;
-            equal &= this->position == rhs.position;
+            equal = (this->map == rhs.map) && (this->position == rhs.position);
         }
     }
 
@@ -532,17 +591,19 @@ bool sc_map_iterator<sc_map_T>::operator==(const sc_map_iterator& rhs)
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-bool sc_map_iterator<sc_map_T>::operator!=(const sc_map_iterator& other) const
+template <typename sc_map_T, typename range_T>
+template <typename other_range_T>
+bool sc_map_iterator<sc_map_T, range_T>::operator!=(
+        const sc_map_iterator<sc_map_T, other_range_T>& other) const
 {
     return !(*this==other);
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-sc_map_iterator<sc_map_T>& sc_map_iterator<sc_map_T>::operator++ ()
+template <typename sc_map_T, typename range_T>
+sc_map_iterator<sc_map_T, range_T>& sc_map_iterator<sc_map_T, range_T>::operator++ ()
 {
-    bool success = range->next_key(position);
+    bool success = range.next_key(position);
     if (!success)
     {
         end_flag = true;
@@ -552,28 +613,28 @@ sc_map_iterator<sc_map_T>& sc_map_iterator<sc_map_T>::operator++ ()
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-typename sc_map_iterator<sc_map_T>::object_type&
-        sc_map_iterator<sc_map_T>::operator*()
+template <typename sc_map_T, typename range_T>
+typename sc_map_iterator<sc_map_T, range_T>::object_type&
+        sc_map_iterator<sc_map_T, range_T>::operator*()
 {
     // todo: ensure that out of range is not accessed (end iterator)
-    return *(map->objects[position]);
+    return *(map->objects.find(map->range, position));
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-typename sc_map_iterator<sc_map_T>::object_type*
-        sc_map_iterator<sc_map_T>::operator->()
+template <typename sc_map_T, typename range_T>
+typename sc_map_iterator<sc_map_T, range_T>::object_type*
+        sc_map_iterator<sc_map_T, range_T>::operator->()
 {
-    return map->objects[position];
+    return map->objects.find(map->range, position);
 }
 
 //******************************************************************************
-template <typename sc_map_T>
+template <typename sc_map_T, typename range_T>
 template <typename data_type>
-void sc_map_iterator<sc_map_T>::write(const data_type& value)
+void sc_map_iterator<sc_map_T, range_T>::write(const data_type& value)
 {
-    for (; *this != map->end(); ++(*this))
+    for (; end_flag != end; ++(*this))
     {
         (**this).write(value);
     }
@@ -582,9 +643,9 @@ void sc_map_iterator<sc_map_T>::write(const data_type& value)
 }
 
 //******************************************************************************
-template <typename sc_map_T>
+template <typename sc_map_T, typename range_T>
 template <typename data_type>
-void sc_map_iterator<sc_map_T>::operator= (const data_type& value)
+void sc_map_iterator<sc_map_T, range_T>::operator= (const data_type& value)
 {
     write(value);
 
@@ -592,11 +653,104 @@ void sc_map_iterator<sc_map_T>::operator= (const data_type& value)
 }
 
 //******************************************************************************
-template <typename sc_map_T>
+template <typename sc_map_T, typename range_T>
+template <typename data_type>
+void sc_map_iterator<sc_map_T, range_T>::write_all(const std::vector<data_type>& values)
+{
+    // The objects are constructed as object_type by the container, therefore
+    // write() is called without virtual dispatch.
+    typename std::vector<data_type>::const_iterator value_it = values.begin();
+    for (; (end_flag != end) && (value_it != values.end()); ++(*this))
+    {
+        (**this).object_type::write(*value_it);
+        ++value_it;
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <typename sc_map_T, typename range_T>
+void sc_map_iterator<sc_map_T, range_T>::write_bits(const sc_bv_base& bits)
+{
+    const int bit_cnt = bits.length();
+    sc_dt::sc_digit word = 0;
+
+    for (int bit = 0; (end_flag != end) && (bit < bit_cnt); ++bit, ++(*this))
+    {
+        if ((bit % SC_DIGIT_SIZE) == 0)
+        {
+            word = bits.get_word(bit / SC_DIGIT_SIZE);
+        }
+
+        const bool value = (word >> (bit % SC_DIGIT_SIZE)) & 1;
+        (**this).object_type::write(value);
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <typename sc_map_T, typename range_T>
+template <typename data_type>
+void sc_map_iterator<sc_map_T, range_T>::read_all(std::vector<data_type>& values)
+{
+    values.clear();
+    values.reserve(range.size());
+
+    for (; end_flag != end; ++(*this))
+    {
+        values.push_back((**this).object_type::read());
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <typename sc_map_T, typename range_T>
+void sc_map_iterator<sc_map_T, range_T>::read_bits(sc_bv_base& bits)
+{
+    const int bit_cnt = bits.length();
+    sc_dt::sc_digit word = 0;
+    int bit = 0;
+
+    for (; (end_flag != end) && (bit < bit_cnt); ++bit, ++(*this))
+    {
+        if ((**this).object_type::read())
+        {
+            word |= static_cast<sc_dt::sc_digit>(1) << (bit % SC_DIGIT_SIZE);
+        }
+
+        if ((bit % SC_DIGIT_SIZE) == (SC_DIGIT_SIZE - 1))
+        {
+            bits.set_word(bit / SC_DIGIT_SIZE, word);
+            word = 0;
+        }
+    }
+
+    if ((bit % SC_DIGIT_SIZE) != 0)
+    {
+        bits.set_word(bit / SC_DIGIT_SIZE, word);
+    }
+
+    for (int word_id = (bit + SC_DIGIT_SIZE - 1) / SC_DIGIT_SIZE;
+         word_id < (bit_cnt + SC_DIGIT_SIZE - 1) / SC_DIGIT_SIZE;
+         ++word_id)
+    {
+        bits.set_word(word_id, 0);
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <typename sc_map_T, typename range_T>
 template <typename signal_T>
-void sc_map_iterator<sc_map_T>::bind(sc_signal<signal_T>& signal)
+void sc_map_iterator<sc_map_T, range_T>::bind(sc_signal<signal_T>& signal)
 {
-    for (; *this != map->end(); ++(*this))
+    SC_MAP_PROFILE(map->name(), "bind(signal)");
+
+    for (; end_flag != end; ++(*this))
     {
         (**this).bind(signal);
     }
@@ -605,9 +759,9 @@ void sc_map_iterator<sc_map_T>::bind(sc_signal<signal_T>& signal)
 }
 
 //******************************************************************************
-template <typename sc_map_T>
+template <typename sc_map_T, typename range_T>
 template <typename signal_T>
-void sc_map_iterator<sc_map_T>::operator() (sc_signal<signal_T>& signal)
+void sc_map_iterator<sc_map_T, range_T>::operator() (sc_signal<signal_T>& signal)
 {
     bind(signal);
 
@@ -615,13 +769,15 @@ void sc_map_iterator<sc_map_T>::operator() (sc_signal<signal_T>& signal)
 }
 
 //******************************************************************************
-template <typename sc_map_T>
+template <typename sc_map_T, typename range_T>
 template <typename signal_range_T, typename signal_T>
-void sc_map_iterator<sc_map_T>::bind(
+void sc_map_iterator<sc_map_T, range_T>::bind(
         sc_map_base<signal_range_T, signal_T>& signal_map)
 {
+    SC_MAP_PROFILE(map->name(), "bind(map)");
+
     for (typename sc_map_base<signal_range_T, signal_T>::iterator signal_it = signal_map.begin();
-         *this != map->end();
+         end_flag != end;
          ++(*this))
     {
         (**this).bind(*signal_it);
@@ -633,9 +789,9 @@ void sc_map_iterator<sc_map_T>::bind(
 }
 
 //******************************************************************************
-template <typename sc_map_T>
+template <typename sc_map_T, typename range_T>
 template <typename signal_range_T, typename signal_T>
-void sc_map_iterator<sc_map_T>::operator() (
+void sc_map_iterator<sc_map_T, range_T>::operator() (
         sc_map_base<signal_range_T, signal_T>& signal_map)
 {
     bind(signal_map);
@@ -644,11 +800,14 @@ void sc_map_iterator<sc_map_T>::operator() (
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-template <typename signal_map_T>
-void sc_map_iterator<sc_map_T>::bind(sc_map_iterator<signal_map_T> signal_it)
+template <typename sc_map_T, typename range_T>
+template <typename signal_map_T, typename signal_it_range_T>
+void sc_map_iterator<sc_map_T, range_T>::bind(
+        sc_map_iterator<signal_map_T, signal_it_range_T> signal_it)
 {
-    for (; *this != map->end(); ++(*this))
+    SC_MAP_PROFILE(map->name(), "bind(iterator)");
+
+    for (; end_flag != end; ++(*this))
     {
         (**this).bind(*signal_it);
 
@@ -659,10 +818,10 @@ void sc_map_iterator<sc_map_T>::bind(sc_map_iterator<signal_map_T> signal_it)
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-template <typename signal_map_T>
-void sc_map_iterator<sc_map_T>::operator() (
-        sc_map_iterator<signal_map_T> signal_it)
+template <typename sc_map_T, typename range_T>
+template <typename signal_map_T, typename signal_it_range_T>
+void sc_map_iterator<sc_map_T, range_T>::operator() (
+        sc_map_iterator<signal_map_T, signal_it_range_T> signal_it)
 {
     bind(signal_it);
 
@@ -670,14 +829,22 @@ void sc_map_iterator<sc_map_T>::operator() (
 }
 
 //******************************************************************************
-template <typename sc_map_T>
-std::pair<typename sc_map_iterator<sc_map_T>::end_type,
-        typename sc_map_iterator<sc_map_T>::key_type>
-        sc_map_iterator<sc_map_T>::get_key() const
+template <typename sc_map_T, typename range_T>
+std::pair<typename sc_map_iterator<sc_map_T, range_T>::end_type,
+        typename sc_map_iterator<sc_map_T, range_T>::key_type>
+        sc_map_iterator<sc_map_T, range_T>::get_key() const
 {
     return std::pair<end_type, key_type>(end_flag, position);
 }
 
+//******************************************************************************
+template <typename sc_map_T, typename range_T>
+inline const typename sc_map_iterator<sc_map_T, range_T>::key_type&
+        sc_map_iterator<sc_map_T, range_T>::get_position() const
+{
+    return position;
+}
+
 ////******************************************************************************
 //template <typename sc_map_T>
 //bool sc_map_iterator<sc_map_T>::update_dim(key_type& key,
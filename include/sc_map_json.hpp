@@ -0,0 +1,25 @@
+/*!
+ * @file sc_map_json.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Helpers for the JSON reports of the size analyzer and the profiler.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include <string>
+#include <ostream>
+
+//******************************************************************************
+
+/*!
+ * @brief Writes text as a quoted JSON string, quotes, backslashes and control
+ *        characters are escaped.
+ */
+void sc_map_write_json_string(std::ostream& output, const std::string& text);
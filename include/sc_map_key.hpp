@@ -56,6 +56,17 @@ public:
      */
     virtual std::string get_string() const =0;
 
+    /*!
+     * @brief Appends the string representation of the key to a buffer.
+     *
+     * The default implementation appends the result of get_string(). Derived
+     * classes override it to format the key without temporary strings, which
+     * is used to generate the names of the objects of a container.
+     *
+     * @param buffer String to which the key is appended.
+     */
+    virtual void append_string(std::string& buffer) const;
+
     /*!
      * @brief Definition of function for test of equality.
      *
@@ -198,8 +198,6 @@ sc_map_linear<object_T>::sc_map_linear(const size_type element_cnt_X,
 
     this->init(range, typename base::creator());
 
-   // simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -216,8 +214,6 @@ sc_map_linear<object_T>::sc_map_linear(const size_type element_cnt_X,
 
     this->init(range, typename base::creator(), configuration);
 
-   // simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -230,8 +226,6 @@ sc_map_linear<object_T>::sc_map_linear(const key_type start_key,
     range_type range = range_type(start_key, end_key);
     this->init(range, typename base::creator());
 
-  //  simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -246,8 +240,6 @@ sc_map_linear<object_T>::sc_map_linear(const key_type start_key,
     range_type range = range_type(start_key, end_key);
     this->init(range, typename base::creator(), configuration);
 
-   // simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -259,8 +251,6 @@ sc_map_linear<object_T>::sc_map_linear(const range_type new_range,
 {
     this->init(new_range, typename base::creator());
 
-  //  simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -273,8 +263,6 @@ sc_map_linear<object_T>::sc_map_linear(const range_type new_range,
 {
     this->init(new_range, typename base::creator(), configuration);
 
-  //  simulation_size.add_sc_map(kind());
-
     return;
 }
 
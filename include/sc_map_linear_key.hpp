@@ -11,9 +11,11 @@
 #pragma once
 
 #include "sc_map_regular_key.hpp"
+#include "sc_map_packed_key.hpp"
 
 #include <string>
 #include <sstream>
+#include <functional>
 
 //******************************************************************************
 
@@ -34,6 +36,28 @@ public:
      */
     using sc_map_regular_key::index_type;
 
+    /*!
+     * @brief Plain value key with the same index as sc_map_linear_key.
+     */
+    typedef sc_map_packed_key<1> packed_type;
+
+    /*!
+     * @brief Comparision class that orders the keys without virtual function
+     *        calls.
+     */
+    class Comperator
+    {
+    public:
+        bool operator()(const sc_map_linear_key& lhs, const sc_map_linear_key& rhs) const
+        {
+            return lhs < rhs;
+        }
+    };
+
+    using sc_map_key::operator==;
+    using sc_map_key::operator!=;
+    using sc_map_key::operator<;
+
     /*!
      * @brief The value of the index/coordinate.
      */
@@ -46,6 +70,13 @@ public:
      */
     sc_map_linear_key(index_type X = 0);
 
+    /*!
+     * @brief Constructor: Converts a plain value key.
+     *
+     * @param packed_key Packed key whose index is copied.
+     */
+    explicit sc_map_linear_key(const packed_type& packed_key);
+
     /*!
      * @brief Destructor: empty
      */
@@ -58,6 +89,28 @@ public:
      */
     virtual std::string get_string() const;
 
+    /*!
+     * @brief Appends the string representation of the index to a buffer.
+     *
+     * @param buffer String to which the index is appended.
+     */
+    virtual void append_string(std::string& buffer) const;
+
+    /*!
+     * @brief Converts the key into a plain value key.
+     *
+     * @return Packed key with the same index.
+     */
+    packed_type packed() const;
+
+    /*!
+     * @brief Accesses the index of a dimension, as for the keys with more
+     *        dimensions. The only dimension is 0.
+     */
+    index_type& operator[](const unsigned int dim);
+    const index_type& operator[](const unsigned int dim) const;
+    void set(const unsigned int dim, const index_type index);
+
     /*!
      * @brief Tests for equality between two key objects.
      *
@@ -83,4 +136,82 @@ public:
      * @return true if lefthand object is smaller, otherwise false
      */
     virtual bool operator<(const sc_map_key& other_key) const;
+
+    /*!
+     * @brief Tests for equality with a key of the same type. Non-virtual.
+     *
+     * @param other_key another sc_map_linear_key.
+     * @return true if equal, otherwise false
+     */
+    bool operator==(const sc_map_linear_key& other_key) const;
+
+    /*!
+     * @brief Tests for inequality with a key of the same type. Non-virtual.
+     *
+     * @param other_key another sc_map_linear_key.
+     * @return true if not equal, otherwise false
+     */
+    bool operator!=(const sc_map_linear_key& other_key) const;
+
+    /*!
+     * @brief Tests if this object is smaller than a key of the same type.
+     *        Non-virtual.
+     *
+     * @param other_key another sc_map_linear_key.
+     * @return true if lefthand object is smaller, otherwise false
+     */
+    bool operator<(const sc_map_linear_key& other_key) const;
+};
+
+//******************************************************************************
+namespace std
+{
+template <>
+struct hash<sc_map_linear_key>
+{
+    size_t operator()(const sc_map_linear_key& key) const
+    {
+        return hash<sc_map_linear_key::packed_type>()(key.packed());
+    }
 };
+}
+
+//******************************************************************************
+
+//******************************************************************************
+inline sc_map_linear_key::index_type& sc_map_linear_key::operator[](const unsigned int dim)
+{
+    return X;
+}
+
+//******************************************************************************
+inline const sc_map_linear_key::index_type& sc_map_linear_key::operator[](const unsigned int dim) const
+{
+    return X;
+}
+
+//******************************************************************************
+inline void sc_map_linear_key::set(const unsigned int dim, const index_type index)
+{
+    (*this)[dim] = index;
+
+    return;
+}
+
+//******************************************************************************
+inline bool sc_map_linear_key::operator==(const sc_map_linear_key& other_key) const
+{
+    return (X == other_key.X);
+}
+
+//******************************************************************************
+inline bool sc_map_linear_key::operator!=(const sc_map_linear_key& other_key) const
+{
+    return !(*this == other_key);
+}
+
+//******************************************************************************
+inline bool sc_map_linear_key::operator<(const sc_map_linear_key& other_key) const
+{
+    return X < other_key.X;
+}
@@ -13,6 +13,8 @@
 #include "sc_map_linear_key.hpp"
 #include "sc_map_regular_range.hpp"
 
+#include <vector>
+
 //******************************************************************************
 
 /*!
@@ -33,6 +35,16 @@ public:
      */
     using sc_map_range::key_type;
 
+    /*!
+     * @brief The type of the indexes is inherited from the key type.
+     */
+    typedef key_type::index_type index_type;
+
+    /*!
+     * @brief List of ranges, returned by difference().
+     */
+    typedef std::vector<sc_map_linear_range> range_vector_type;
+
     /*!
      * @brief Constructor: INVALID
      *
@@ -55,12 +67,12 @@ public:
      * @brief Constructor: Creates new linear range between two keys.
      *
      * The last_key does not need to be larger than the first_key. This allows
-     * to define down counting ranges. Generally, no difference exists to
-     * sc_map_linear_range(start_key, end_key), but it is here to keep
-     * consitency with the other range types.
+     * to define down counting ranges. As for the other range types, start_key
+     * and end_key have to lie within base_range, otherwise an error is
+     * reported with SC_REPORT_ERROR.
      *
-     * @param base_range Defines the range which the keys are part of. Not
-     *        relevant for sc_map_linear_range.
+     * @param base_range Defines the range which the keys are part of. No
+     *        check is done if it is NULL.
      * @param start_key First key of the range
      * @param end_key Last key of the range
      */
@@ -93,6 +105,91 @@ public:
      */
     virtual bool next_key(key_type& key) const;
 
+    /*!
+     * @brief Number of keys in the range.
+     *
+     * @return Number of keys, calculated from start_key and end_key.
+     */
+    virtual std::size_t size() const;
+
+    /*!
+     * @brief Tests if a key lies between start_key and end_key.
+     *
+     * @param key Key to test.
+     * @return true if the key is part of the range.
+     */
+    virtual bool key_in_range(const key_type& key) const;
+
+    /*!
+     * @brief Calculates the position of a key within the range.
+     *
+     * The position corresponds to the order of the keys given by next_key(),
+     * i.e. start_key is at position 0 for both counting directions.
+     *
+     * @param key Key for which the position is calculated.
+     * @param index Set to the position of the key within the range.
+     * @return true if the key lies within the range, otherwise false.
+     */
+    bool index_of(const key_type& key, std::size_t& index) const;
+
+    /*!
+     * @brief Calculates the key at a position of the range. Inverse function
+     *        of index_of().
+     *
+     * @param index Position within the range, must be smaller than size().
+     * @return Key at this position.
+     */
+    key_type key_at(const std::size_t index) const;
+
+    /*!
+     * @brief Number of keys within the box spanned by the range.
+     *
+     * @return Size of the flat array needed to store all elements of the range.
+     */
+    std::size_t storage_size() const;
+
+    /*!
+     * @brief Calculates the position of a key within the flat storage.
+     *
+     * The position is independent of the counting direction, i.e. the
+     * smallest key of the range is always stored at position 0.
+     *
+     * @param key Key for which the position is calculated.
+     * @param offset Set to the position of the key within the storage.
+     * @return true if the key lies within the range, otherwise false.
+     */
+    bool storage_offset(const key_type& key, std::size_t& offset) const;
+
+    /*!
+     * @brief Calculates the key that is stored at a position of the flat
+     *        storage. Inverse function of storage_offset().
+     *
+     * @param offset Position within the storage.
+     * @return Key stored at this position.
+     */
+    key_type storage_key(const std::size_t offset) const;
+
+    /*!
+     * @brief Calculates the keys that lie in both ranges.
+     *
+     * The result keeps the counting direction of this range.
+     *
+     * @param other Range to intersect with.
+     * @param result Set to the intersection if it is not empty.
+     * @return false if the ranges do not overlap.
+     */
+    bool intersection(const sc_map_linear_range& other, sc_map_linear_range& result) const;
+
+    /*!
+     * @brief Calculates the keys of this range that do not lie in another
+     *        range.
+     *
+     * @param other Range to remove from this range.
+     * @return The parts below and above the other range, if they exist, in
+     *         this order. Empty if other covers this range.
+     */
+    range_vector_type difference(const sc_map_linear_range& other) const;
+
 private:
     /*!
      * @brief Defines the direction of counting of the keys: UP or DOWN.
@@ -101,13 +198,29 @@ private:
      */
     direction X_dir;
 
+    /*!
+     * @brief Smallest index of the range, stored at position 0 of the storage.
+     */
+    index_type X_low;
+
+    /*!
+     * @brief Number of keys within the range.
+     */
+    std::size_t X_size;
+
     /*!
      * @brief Common initialization tasks for all contstructors.
      *
-     * The counting direction is set by this function.
+     * The counting direction and the storage layout are set by this function.
      *
      * @param start_key The key from which the range starts.
      * @param end_key The key at which the range stops.
      */
     void init(const key_type& start_key, const key_type& end_key);
+
+    /*!
+     * @brief Creates a range between two indexes, counting in the direction
+     *        of this range.
+     */
+    sc_map_linear_range part(const index_type part_low, const index_type part_high) const;
 };
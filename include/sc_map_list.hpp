@@ -46,8 +46,24 @@ public:
     sc_map_list(const sc_module_name name, const std::map<key_value_T, config_T>& configuration);
     virtual ~sc_map_list() {};
 
+    /*!
+     * @brief Binds each port to the signal with the same key.
+     *
+     * The ports and the signals are walked side by side in the order of their
+     * keys, so binding is O(n+m) without a lookup per port.
+     *
+     * Ports whose key is not part of the signal map stay unbound. They are
+     * reported together in a single warning, which lists the first few of
+     * their keys. Unlike the bind() functions of sc_map_base, which return
+     * nothing, the keys of all unbound ports are returned, so that the caller
+     * can bind them otherwise before the simulation starts.
+     *
+     * @param signal_map Container with the signals.
+     * @return Keys of the ports for which no signal was found, in key order.
+     *         Empty if all ports were bound.
+     */
     template <typename signal_T>
-    void bind(sc_map_base<range_type, signal_T>& signal_map);
+    key_vector_type bind(sc_map_base<range_type, signal_T>& signal_map);
     template <typename signal_T>
     void operator()(sc_map_base<range_type, signal_T>& signal_map);
     // TODO: add binding for iterators, which are not in the correct order
@@ -74,8 +90,6 @@ sc_map_list<key_value_T, object_T>::sc_map_list(const key_value_vector_type& key
 
     this->init(range, typename base::creator());
 
-    //simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -97,8 +111,6 @@ sc_map_list<key_value_T, object_T>::sc_map_list(const key_value_vector_type& key
 
     this->init(range, typename base::creator(), configuration);
 
-//    simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -110,8 +122,6 @@ sc_map_list<key_value_T, object_T>::sc_map_list(const range_type& new_range,
 {
     this->init(new_range, typename base::creator());
 
-    //simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -124,8 +134,6 @@ sc_map_list<key_value_T, object_T>::sc_map_list(const range_type& new_range,
 {
     this->init(new_range, typename base::creator(), configuration);
 
-//  simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -149,38 +157,73 @@ sc_map_list<key_value_T, object_T>::sc_map_list(const sc_module_name name,
 
     this->init(new_range, typename base::creator(), configuration_vec);
 
-//    simulation_size.add_sc_map(kind());
-
     return;
 }
 
 //******************************************************************************
 template <typename key_value_T, typename object_T>
 template <typename signal_T>
-void sc_map_list<key_value_T, object_T>::bind(
+typename sc_map_list<key_value_T, object_T>::key_vector_type
+        sc_map_list<key_value_T, object_T>::bind(
         sc_map_base<range_type, signal_T>& signal_map)
 {
-    // todo: check for equal size
     // todo: check for same object
     // todo: check for compatibility of port and signal (pre-processor)
 
-    for (typename sc_map_list<key_value_T, object_T>::iterator port_it = this->begin();
-         port_it != this->end();
+    SC_MAP_PROFILE(this->name(), "bind(map)");
+
+    typedef typename base::storage_type::const_iterator port_iterator;
+    typedef typename sc_map_base<range_type, signal_T>::storage_type::const_iterator signal_iterator;
+
+    key_vector_type unmatched_keys;
+    typename key_type::Comperator key_less;
+
+    // both storages are ordered by key, so each signal is passed only once
+    signal_iterator signal_it = signal_map.objects.begin();
+    for (port_iterator port_it = this->objects.begin();
+         port_it != this->objects.end();
          ++port_it)
     {
-        std::pair<bool, key_type> port_key = this->get_key(*port_it);
-        if (port_key.first)
+        while ((signal_it != signal_map.objects.end())
+               && key_less(signal_it->first, port_it->first))
+        {
+            ++signal_it;
+        }
+
+        if ((signal_it != signal_map.objects.end())
+            && !key_less(port_it->first, signal_it->first))
         {
-            typename sc_map_list<key_value_T, signal_T>::object_type& signal = signal_map.at(port_key.second);
-            port_it->bind(signal);
+            port_it->second->bind(*signal_it->second);
+            ++signal_it;
         }
         else
         {
-            std::cerr << "sc_map_list.bind: Problem with iterator" << std::endl;
+            unmatched_keys.push_back(port_it->first);
         }
     }
 
-    return;
+    if (!unmatched_keys.empty())
+    {
+        const std::size_t listed_key_cnt = 4;
+
+        std::ostringstream message;
+        message << this->name() << ": " << unmatched_keys.size()
+                << " port(s) without signal in " << signal_map.name() << ":";
+        for (std::size_t i = 0;
+             (i < unmatched_keys.size()) && (i < listed_key_cnt);
+             ++i)
+        {
+            message << " " << unmatched_keys[i];
+        }
+        if (unmatched_keys.size() > listed_key_cnt)
+        {
+            message << " ...";
+        }
+
+        SC_REPORT_WARNING("sc_map_list", message.str().c_str());
+    }
+
+    return unmatched_keys;
 }
 
 //******************************************************************************
@@ -17,6 +17,7 @@
 
 #include <string>
 #include <sstream>
+#include <functional>
 
 //******************************************************************************
 template <typename value_T>
@@ -25,6 +26,19 @@ class sc_map_list_key : public sc_map_key
 public:
     typedef value_T value_type;
 
+    class Comperator
+    {
+    public:
+        bool operator()(const sc_map_list_key& lhs, const sc_map_list_key& rhs) const
+        {
+            return lhs.value < rhs.value;
+        }
+    };
+
+    using sc_map_key::operator==;
+    using sc_map_key::operator!=;
+    using sc_map_key::operator<;
+
     value_type value;
 
     sc_map_list_key();
@@ -35,9 +49,27 @@ public:
 
     virtual bool operator==(const sc_map_key& other_key) const;
     virtual bool operator<(const sc_map_key& other_key) const;
+
+    bool operator==(const sc_map_list_key& other_key) const;
+    bool operator!=(const sc_map_list_key& other_key) const;
+    bool operator<(const sc_map_list_key& other_key) const;
+
     operator value_T() const;
 };
 
+//******************************************************************************
+namespace std
+{
+template <typename value_T>
+struct hash<sc_map_list_key<value_T> >
+{
+    size_t operator()(const sc_map_list_key<value_T>& key) const
+    {
+        return hash<value_T>()(key.value);
+    }
+};
+}
+
 //*****************************************************************************
 
 //******************************************************************************
@@ -65,20 +97,35 @@ std::string sc_map_list_key<value_T>::get_string() const
 template <typename value_T>
 bool sc_map_list_key<value_T>::operator==(const sc_map_key& other_key) const
 {
-    const sc_map_list_key* other_key_linear =
-            dynamic_cast<const sc_map_list_key<value_type>*>(&other_key);
-
-    return (this->value == other_key_linear->value);
+    return (*this == dynamic_cast<const sc_map_list_key&>(other_key));
 }
 
 //******************************************************************************
 template <typename value_T>
 bool sc_map_list_key<value_T>::operator<(const sc_map_key& other_key) const
 {
-    const sc_map_list_key* other_key_linear =
-            dynamic_cast<const sc_map_list_key<value_type>*>(&other_key);
+    return (*this < dynamic_cast<const sc_map_list_key&>(other_key));
+}
+
+//******************************************************************************
+template <typename value_T>
+inline bool sc_map_list_key<value_T>::operator==(const sc_map_list_key& other_key) const
+{
+    return (value == other_key.value);
+}
 
-    return (this->value < other_key_linear->value);
+//******************************************************************************
+template <typename value_T>
+inline bool sc_map_list_key<value_T>::operator!=(const sc_map_list_key& other_key) const
+{
+    return !(*this == other_key);
+}
+
+//******************************************************************************
+template <typename value_T>
+inline bool sc_map_list_key<value_T>::operator<(const sc_map_list_key& other_key) const
+{
+    return (value < other_key.value);
 }
 
 //******************************************************************************
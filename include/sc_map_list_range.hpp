@@ -18,8 +18,25 @@
 #include "sc_map_range.hpp"
 
 #include <vector>
+#include <map>
+#include <memory>
+#include <cstddef>
 
 //******************************************************************************
+
+/*!
+ * @brief Range that consists of an arbitrary list of keys.
+ *
+ * The list of keys is shared between copies of a range and only copied when a
+ * shared list is modified by add_key(). Copying a range, e.g. into an
+ * iterator, therefore does not allocate memory.
+ *
+ * Together with the keys, an index from each key to its position in the list
+ * is kept. Each range additionally remembers the position of the key that was
+ * returned last by next_key(). Stepping through the range is therefore O(1),
+ * while key_in_range() and next_key() on an arbitrary key are O(log n).
+ * A key that is already part of the list is not added a second time.
+ */
 template <typename value_T>
 class sc_map_list_range : public sc_map_range<sc_map_list_key<value_T> >
 {
@@ -27,6 +44,8 @@ public:
     typedef sc_map_range<sc_map_list_key<value_T> > base;
     typedef value_T value_type;
     typedef sc_map_list_key<value_type> key_type;
+    typedef typename base::key_vector_type key_vector_type;
+    typedef std::map<key_type, std::size_t, typename key_type::Comperator> position_map_type;
 
     sc_map_list_range();
     sc_map_list_range(const std::vector<key_type>& keys);
@@ -41,37 +60,78 @@ public:
 
     virtual key_type first() const;
     virtual key_type last() const;
+
+    virtual std::size_t size() const;
+    virtual bool empty() const;
+    virtual bool key_in_range(const key_type& key) const;
     virtual bool next_key(key_type& key) const;
+    virtual key_vector_type get_key_vector() const;
+    virtual std::size_t heap_size() const;
+
+    bool index_of(const key_type& key, std::size_t& index) const;
+    key_type key_at(const std::size_t index) const;
+
+    /*!
+     * @brief Set operations on the keys of two list ranges.
+     *
+     * The keys of the result keep the order of this range, merge() appends
+     * the keys of other that are not part of this range. The membership
+     * tests use the key index, so each operation is O(n log n).
+     */
+    sc_map_list_range merge(const sc_map_list_range& other) const;
+    sc_map_list_range intersection(const sc_map_list_range& other) const;
+    sc_map_list_range difference(const sc_map_list_range& other) const;
 
 private:
-    std::vector<key_type> keys;
+    class key_list_type
+    {
+    public:
+        key_vector_type keys;
+        position_map_type positions;
+    };
+
+    std::shared_ptr<key_list_type> key_list;
+    mutable std::size_t last_position;
+
+    bool find_position(const key_type& key, std::size_t& position) const;
 };
 
 //******************************************************************************
 
 //******************************************************************************
 template <typename value_T>
-sc_map_list_range<value_T>::sc_map_list_range()
+sc_map_list_range<value_T>::sc_map_list_range() :
+        last_position(0)
 {}
 
 //******************************************************************************
 template <typename value_T>
 sc_map_list_range<value_T>::sc_map_list_range(
         const std::vector<key_type>& keys) :
-        keys(keys)
-{}
+        last_position(0)
+{
+    for (typename std::vector<key_type>::const_iterator key_it = keys.begin();
+         key_it != keys.end();
+         ++key_it)
+    {
+        add_key(*key_it);
+    }
+
+    return;
+}
 
 //******************************************************************************
 template <typename value_T>
 sc_map_list_range<value_T>::sc_map_list_range(
-        const std::vector<value_type>& values)
+        const std::vector<value_type>& values) :
+        last_position(0)
 {
     for (typename std::vector<value_type>::const_iterator value_it = values.begin();
          value_it != values.end();
          ++ value_it)
     {
         key_type key = key_type(*value_it);
-        keys.push_back(key);
+        add_key(key);
     }
 
     return;
@@ -81,9 +141,9 @@ sc_map_list_range<value_T>::sc_map_list_range(
 template <typename value_T>
 sc_map_list_range<value_T>::sc_map_list_range(
         const sc_map_range<key_type>* source_range, const key_type& start_key,
-        const key_type& end_key)
+        const key_type& end_key) :
+        last_position(0)
 {
-
     if (source_range->key_in_range(start_key))
     {
         key_type key = start_key;
@@ -91,7 +151,7 @@ sc_map_list_range<value_T>::sc_map_list_range(
         do
         {
             add_key(key);
-        } while (source_range->next_key(key));
+        } while ((key != end_key) && source_range->next_key(key));
     }
     else
     {
@@ -112,7 +172,22 @@ sc_map_list_range<value_T>* sc_map_list_range<value_T>::clone() const
 template <typename value_T>
 void sc_map_list_range<value_T>::add_key(const key_type& new_key)
 {
-    keys.push_back(new_key);
+    if (!key_list)
+    {
+        key_list = std::make_shared<key_list_type>();
+    }
+    else if (key_list->positions.count(new_key) != 0)
+    {
+        return;
+    }
+    else if (!key_list.unique())
+    {
+        key_list = std::make_shared<key_list_type>(*key_list);
+    }
+
+    key_list->positions.insert(typename position_map_type::value_type(new_key,
+            key_list->keys.size()));
+    key_list->keys.push_back(new_key);
 
     return;
 }
@@ -131,7 +206,12 @@ template <typename key_T>
 typename sc_map_list_range<key_T>::key_type
         sc_map_list_range<key_T>::first() const
 {
-    return keys[0];
+    if (empty())
+    {
+        return key_type();
+    }
+
+    return key_list->keys[0];
 }
 
 //******************************************************************************
@@ -139,7 +219,40 @@ template <typename key_T>
 typename sc_map_list_range<key_T>::key_type
         sc_map_list_range<key_T>::last() const
 {
-    return keys[keys.size()-1];
+    if (empty())
+    {
+        return key_type();
+    }
+
+    return key_list->keys[key_list->keys.size()-1];
+}
+
+//******************************************************************************
+template <typename key_T>
+std::size_t sc_map_list_range<key_T>::size() const
+{
+    if (!key_list)
+    {
+        return 0;
+    }
+
+    return key_list->keys.size();
+}
+
+//******************************************************************************
+template <typename key_T>
+bool sc_map_list_range<key_T>::empty() const
+{
+    return size() == 0;
+}
+
+//******************************************************************************
+template <typename key_T>
+bool sc_map_list_range<key_T>::key_in_range(const key_type& key) const
+{
+    std::size_t position;
+
+    return find_position(key, position);
 }
 
 //******************************************************************************
@@ -148,24 +261,160 @@ bool sc_map_list_range<key_T>::next_key(key_type& key) const
 {
     // todo: reverse access
 
-    for (typename std::vector<key_type>::const_iterator key_it = keys.begin();
-         key_it != keys.end();
-         ++key_it)
+    std::size_t position;
+    if (!find_position(key, position))
+    {
+        return false;
+    }
+
+    ++position;
+    if (position >= key_list->keys.size())
+    {
+        return false;
+    }
+
+    key = key_list->keys[position];
+    last_position = position;
+
+    return true;
+}
+
+//******************************************************************************
+template <typename key_T>
+typename sc_map_list_range<key_T>::key_vector_type
+        sc_map_list_range<key_T>::get_key_vector() const
+{
+    if (!key_list)
+    {
+        return key_vector_type();
+    }
+
+    return key_list->keys;
+}
+
+//******************************************************************************
+template <typename key_T>
+std::size_t sc_map_list_range<key_T>::heap_size() const
+{
+    if (!key_list)
+    {
+        return 0;
+    }
+
+    // a node of std::map holds the value, the color and three pointers
+    const std::size_t node_bytes = sizeof(typename position_map_type::value_type) + 4 * sizeof(void*);
+
+    return sizeof(key_list_type) + key_list->keys.capacity() * sizeof(key_type)
+            + key_list->positions.size() * node_bytes;
+}
+
+//******************************************************************************
+template <typename key_T>
+bool sc_map_list_range<key_T>::index_of(const key_type& key,
+        std::size_t& index) const
+{
+    return find_position(key, index);
+}
+
+//******************************************************************************
+template <typename key_T>
+typename sc_map_list_range<key_T>::key_type
+        sc_map_list_range<key_T>::key_at(const std::size_t index) const
+{
+    return key_list->keys[index];
+}
+
+//******************************************************************************
+template <typename key_T>
+sc_map_list_range<key_T> sc_map_list_range<key_T>::merge(
+        const sc_map_list_range& other) const
+{
+    sc_map_list_range merged_range = *this;
+
+    if (other.key_list)
+    {
+        for (typename key_vector_type::const_iterator key_it = other.key_list->keys.begin();
+             key_it != other.key_list->keys.end();
+             ++key_it)
+        {
+            merged_range.add_key(*key_it);
+        }
+    }
+
+    return merged_range;
+}
+
+//******************************************************************************
+template <typename key_T>
+sc_map_list_range<key_T> sc_map_list_range<key_T>::intersection(
+        const sc_map_list_range& other) const
+{
+    sc_map_list_range common_range;
+
+    if (key_list)
     {
-        if (*key_it == key)
+        for (typename key_vector_type::const_iterator key_it = key_list->keys.begin();
+             key_it != key_list->keys.end();
+             ++key_it)
         {
-            ++key_it;
-            if (key_it != keys.end())
+            if (other.key_in_range(*key_it))
             {
-                key = *key_it;
-                return true;
+                common_range.add_key(*key_it);
             }
-            else
+        }
+    }
+
+    return common_range;
+}
+
+//******************************************************************************
+template <typename key_T>
+sc_map_list_range<key_T> sc_map_list_range<key_T>::difference(
+        const sc_map_list_range& other) const
+{
+    sc_map_list_range remaining_range;
+
+    if (key_list)
+    {
+        for (typename key_vector_type::const_iterator key_it = key_list->keys.begin();
+             key_it != key_list->keys.end();
+             ++key_it)
+        {
+            if (!other.key_in_range(*key_it))
             {
-                return false;
+                remaining_range.add_key(*key_it);
             }
         }
     }
 
-    return false;
+    return remaining_range;
+}
+
+//******************************************************************************
+template <typename key_T>
+bool sc_map_list_range<key_T>::find_position(const key_type& key,
+        std::size_t& position) const
+{
+    if (!key_list)
+    {
+        return false;
+    }
+
+    if ((last_position < key_list->keys.size()) &&
+        (key_list->keys[last_position] == key))
+    {
+        position = last_position;
+        return true;
+    }
+
+    typename position_map_type::const_iterator position_it = key_list->positions.find(key);
+    if (position_it == key_list->positions.end())
+    {
+        return false;
+    }
+
+    position = position_it->second;
+    last_position = position;
+
+    return true;
 }
@@ -0,0 +1,205 @@
+/*!
+ * @file sc_map_nd.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_base.hpp"
+#include <systemc.h>
+
+#include "sc_map_nd_key.hpp"
+#include "sc_map_nd_range.hpp"
+#include "sc_map_shift.hpp"
+
+#include <type_traits>
+
+//******************************************************************************
+
+/*!
+ * @brief Container for a regular structure with N dimensions.
+ *
+ * sc_map_square, sc_map_cube and sc_map_4d are derived from this class.
+ * Higher dimensional structures are directly instantiated, e.g.
+ * sc_map_nd<5, sc_signal<bool> > with keys of type sc_map_nd_key<5>.
+ *
+ * The default key sc_map_nd_key<N> packs the indexes into 64-bit words. For
+ * N >= 4 each index has 16 bits, i.e. the indexes of the container have to
+ * lie within [-32768, 32767]. Keys outside of this range are reported with
+ * SC_REPORT_ERROR when they are created.
+ *
+ * @tparam N Number of dimensions.
+ * @tparam object_T Type of the objects in the container.
+ * @tparam key_T Key type of the container.
+ */
+template <unsigned int N, typename object_T, typename key_T = sc_map_nd_key<N> >
+class sc_map_nd : public sc_map_base<sc_map_nd_range<N, key_T>, object_T>
+{
+public:
+    typedef sc_map_base<sc_map_nd_range<N, key_T>, object_T> base;
+    typedef typename base::range_type range_type;
+    typedef typename base::key_type key_type;
+    typedef typename base::key_vector_type key_vector_type;
+    typedef typename base::key_type::index_type index_type;
+    typedef typename base::size_type size_type;
+    typedef sc_map_shift<range_type, object_T> shift_type;
+
+    static const unsigned int dimensions = N;
+
+    sc_map_nd(const key_type& start_key, const key_type& end_key, const sc_module_name name);
+    template <typename config_type>
+    sc_map_nd(const key_type& start_key, const key_type& end_key, const sc_module_name name, const config_type& configuration);
+
+    sc_map_nd(const range_type& new_range, const sc_module_name name);
+    template <typename config_type>
+    sc_map_nd(const range_type& new_range, const sc_module_name name, const config_type& configuration);
+
+    virtual ~sc_map_nd() {};
+
+    using base::at;
+    template <typename... index_T>
+    typename std::enable_if<sc_map_is_index_list<index_T...>::value, object_T&>::type
+            at(const index_T... indexes);
+
+    /*!
+     * @brief Returns the object at an offset from a key.
+     *
+     * @param key Key of the element whose neighbor is requested.
+     * @param offset Signed offset in every dimension.
+     * @param wrap If true, the container is treated as a torus.
+     * @return Pointer to the neighbor, NULL if it lies outside of the
+     *         container.
+     */
+    object_T* neighbor(const key_type& key, const key_type& offset, const bool wrap = false);
+
+    /*!
+     * @brief Returns the container with the keys shifted by an offset, e.g.
+     *        ports.shift(0,+1).bind(signals).
+     */
+    shift_type shift(const key_type& offset);
+    template <typename... index_T>
+    typename std::enable_if<sc_map_is_index_list<index_T...>::value, shift_type>::type
+            shift(const index_T... offsets);
+
+    const char* kind() const;
+
+protected:
+    /*!
+     * @brief Constructor for derived classes, which initialize the objects
+     *        themselves.
+     */
+    sc_map_nd(const sc_module_name name);
+};
+
+//******************************************************************************
+
+//******************************************************************************
+template <unsigned int N, typename object_T, typename key_T>
+sc_map_nd<N, object_T, key_T>::sc_map_nd(const sc_module_name name) :
+        base(name)
+{}
+
+//******************************************************************************
+template <unsigned int N, typename object_T, typename key_T>
+sc_map_nd<N, object_T, key_T>::sc_map_nd(const key_type& start_key,
+        const key_type& end_key, const sc_module_name name) :
+        base(name)
+{
+    range_type range = range_type(start_key, end_key);
+    this->init(range, typename base::creator());
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename object_T, typename key_T>
+template <typename config_type>
+sc_map_nd<N, object_T, key_T>::sc_map_nd(const key_type& start_key,
+        const key_type& end_key, const sc_module_name name,
+        const config_type& configuration) :
+        base(name)
+{
+    range_type range = range_type(start_key, end_key);
+    this->init(range, typename base::creator(), configuration);
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename object_T, typename key_T>
+sc_map_nd<N, object_T, key_T>::sc_map_nd(const range_type& new_range,
+        const sc_module_name name) :
+        base(name)
+{
+    this->init(new_range, typename base::creator());
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename object_T, typename key_T>
+template <typename config_type>
+sc_map_nd<N, object_T, key_T>::sc_map_nd(const range_type& new_range,
+        const sc_module_name name, const config_type& configuration) :
+        base(name)
+{
+    this->init(new_range, typename base::creator(), configuration);
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename object_T, typename key_T>
+template <typename... index_T>
+typename std::enable_if<sc_map_is_index_list<index_T...>::value, object_T&>::type
+        sc_map_nd<N, object_T, key_T>::at(const index_T... indexes)
+{
+    return base::at(key_type(indexes...));
+}
+
+//******************************************************************************
+template <unsigned int N, typename object_T, typename key_T>
+object_T* sc_map_nd<N, object_T, key_T>::neighbor(const key_type& key,
+        const key_type& offset, const bool wrap)
+{
+    key_type neighbor_key;
+    if (!this->range.shifted_key(key, offset, wrap, neighbor_key))
+    {
+        return NULL;
+    }
+
+    return this->objects.find(this->range, neighbor_key);
+}
+
+//******************************************************************************
+template <unsigned int N, typename object_T, typename key_T>
+inline typename sc_map_nd<N, object_T, key_T>::shift_type
+        sc_map_nd<N, object_T, key_T>::shift(const key_type& offset)
+{
+    return shift_type(*this, offset);
+}
+
+//******************************************************************************
+template <unsigned int N, typename object_T, typename key_T>
+template <typename... index_T>
+inline typename std::enable_if<sc_map_is_index_list<index_T...>::value,
+        typename sc_map_nd<N, object_T, key_T>::shift_type>::type
+        sc_map_nd<N, object_T, key_T>::shift(const index_T... offsets)
+{
+    return shift_type(*this, key_type(offsets...));
+}
+
+//******************************************************************************
+template <unsigned int N, typename object_T, typename key_T>
+const char* sc_map_nd<N, object_T, key_T>::kind() const
+{
+    return ("sc_map_nd");
+}
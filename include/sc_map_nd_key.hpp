@@ -0,0 +1,34 @@
+/*!
+ * @file sc_map_nd_key.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Key for regular structures with an arbitrary number of dimensions.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_packed_key.hpp"
+
+//******************************************************************************
+
+/*!
+ * @brief Key of an N-dimensional regular structure.
+ *
+ * The key is the non-virtual sc_map_packed_key, so that the keys of an
+ * sc_map_nd are compared and stepped without virtual dispatch. Index 0 is the
+ * most significant one and index N-1 changes fastest when the range is
+ * traversed. The indexes are read with operator[] and written with set().
+ * Keys with named members for two to four dimensions are provided by
+ * sc_map_square_key, sc_map_cube_key and sc_map_4d_key, which convert
+ * implicitly to this key.
+ *
+ * @tparam N Number of dimensions of the key.
+ */
+template <unsigned int N>
+using sc_map_nd_key = sc_map_packed_key<N>;
@@ -0,0 +1,540 @@
+/*!
+ * @file sc_map_nd_range.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Range of regular structures with an arbitrary number of dimensions.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_regular_range.hpp"
+#include "sc_map_nd_key.hpp"
+
+#include <systemc.h>
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+//******************************************************************************
+
+/*!
+ * @brief Per dimension steps of sc_map_nd_range, unrolled at compile time.
+ *
+ * Each function handles dimension dim and recurses to dim-1, so that the
+ * generated code of an N-dimensional range is equal to N nested loops.
+ */
+template <unsigned int dim>
+struct sc_map_nd_unroll
+{
+    template <typename range_T, typename key_T>
+    static bool next_key(const range_T& range, key_T& key);
+
+    template <typename range_T, typename key_T>
+    static bool storage_offset(const range_T& range, const key_T& key, std::size_t& offset);
+};
+
+//******************************************************************************
+template <>
+struct sc_map_nd_unroll<0>
+{
+    template <typename range_T, typename key_T>
+    static bool next_key(const range_T& range, key_T& key);
+
+    template <typename range_T, typename key_T>
+    static bool storage_offset(const range_T& range, const key_T& key, std::size_t& offset);
+};
+
+//******************************************************************************
+
+/*!
+ * @brief Range of an N-dimensional box of keys.
+ *
+ * Every dimension runs from start_key to end_key, either upwards or
+ * downwards. The last dimension changes fastest when the range is traversed.
+ * The key type has to provide operator[] to read and set() to write the index
+ * of a dimension, which allows to use the named keys sc_map_square_key,
+ * sc_map_cube_key and sc_map_4d_key as well as the packed sc_map_nd_key.
+ *
+ * @tparam N Number of dimensions.
+ * @tparam key_T Key type of the range.
+ */
+template <unsigned int N, typename key_T = sc_map_nd_key<N> >
+class sc_map_nd_range : public sc_map_regular_range<key_T>
+{
+    template <unsigned int dim>
+    friend struct sc_map_nd_unroll;
+
+public:
+    typedef sc_map_regular_range<key_T> base;
+    typedef typename base::key_type key_type;
+    typedef typename key_type::index_type index_type;
+    typedef typename base::direction direction;
+    typedef std::vector<sc_map_nd_range> range_vector_type;
+
+    static const unsigned int dimensions = N;
+
+    sc_map_nd_range();
+    sc_map_nd_range(const key_type& start_key, const key_type& end_key);
+
+    /*!
+     * @brief Constructor: Creates a sub-range of another range.
+     *
+     * Reports an error with SC_REPORT_ERROR if start_key or end_key lie
+     * outside of base_range.
+     */
+    sc_map_nd_range(const sc_map_range<key_type>* base_range, const key_type& start_key, const key_type& end_key);
+    virtual ~sc_map_nd_range() {};
+
+    virtual sc_map_nd_range* clone() const;
+
+    virtual bool next_key(key_type& key) const;
+
+    virtual std::size_t size() const;
+    virtual bool key_in_range(const key_type& key) const;
+
+    /*!
+     * @brief Calculates the position of a key in the order given by
+     *        next_key(), start_key is at position 0.
+     */
+    bool index_of(const key_type& key, std::size_t& index) const;
+    key_type key_at(const std::size_t index) const;
+
+    /*!
+     * @brief Calculates the key that lies at an offset from another key.
+     *
+     * @param key Key from which the offset is applied.
+     * @param offset Signed offset in every dimension.
+     * @param wrap If true, keys that leave the box re-enter it on the opposite
+     *        side, as in a torus.
+     * @param shifted Set to the shifted key if it lies within the box.
+     * @return false if the shifted key lies outside of the box.
+     */
+    bool shifted_key(const key_type& key, const key_type& offset, const bool wrap, key_type& shifted) const;
+
+    /*!
+     * @brief Calculates the box of keys that lie in both ranges.
+     *
+     * The result keeps the counting directions of this range.
+     *
+     * @param other Range to intersect with.
+     * @param result Set to the intersection if it is not empty.
+     * @return false if the ranges do not overlap.
+     */
+    bool intersection(const sc_map_nd_range& other, sc_map_nd_range& result) const;
+
+    /*!
+     * @brief Calculates the keys of this range that do not lie in another
+     *        range, as a list of at most 2*N disjoint boxes.
+     *
+     * The box is cut into slabs dimension by dimension: first the parts below
+     * and above the other range in dimension 0, then within the remaining
+     * slab the parts in dimension 1, and so on. The boxes keep the counting
+     * directions of this range and are returned in this order.
+     *
+     * @param other Range to remove from this range.
+     * @return Disjoint boxes, empty if other covers this range.
+     */
+    range_vector_type difference(const sc_map_nd_range& other) const;
+
+    std::size_t storage_size() const;
+    bool storage_offset(const key_type& key, std::size_t& offset) const;
+    key_type storage_key(const std::size_t offset) const;
+
+private:
+    direction dir[N];
+    index_type low[N];
+    std::size_t extent[N];
+    std::size_t stride[N];
+
+    void init(const sc_map_range<key_type>* base_range, const key_type& start_key, const key_type& end_key);
+    sc_map_nd_range box(const index_type (&box_low)[N], const index_type (&box_high)[N]) const;
+};
+
+//******************************************************************************
+
+//******************************************************************************
+template <unsigned int dim>
+template <typename range_T, typename key_T>
+inline bool sc_map_nd_unroll<dim>::next_key(const range_T& range, key_T& key)
+{
+    if (key[dim] != range.end_key[dim])
+    {
+        key.set(dim, key[dim] + ((range.dir[dim] == range_T::UP) ? 1 : -1));
+        return true;
+    }
+
+    if (sc_map_nd_unroll<dim-1>::next_key(range, key))
+    {
+        key.set(dim, range.start_key[dim]);
+        return true;
+    }
+
+    return false;
+}
+
+//******************************************************************************
+template <typename range_T, typename key_T>
+inline bool sc_map_nd_unroll<0>::next_key(const range_T& range, key_T& key)
+{
+    if (key[0] != range.end_key[0])
+    {
+        key.set(0, key[0] + ((range.dir[0] == range_T::UP) ? 1 : -1));
+        return true;
+    }
+
+    return false;
+}
+
+//******************************************************************************
+template <unsigned int dim>
+template <typename range_T, typename key_T>
+inline bool sc_map_nd_unroll<dim>::storage_offset(const range_T& range,
+        const key_T& key, std::size_t& offset)
+{
+    std::size_t dim_offset = key[dim] - range.low[dim];
+    if (dim_offset >= range.extent[dim])
+    {
+        return false;
+    }
+    offset += dim_offset * range.stride[dim];
+
+    return sc_map_nd_unroll<dim-1>::storage_offset(range, key, offset);
+}
+
+//******************************************************************************
+template <typename range_T, typename key_T>
+inline bool sc_map_nd_unroll<0>::storage_offset(const range_T& range,
+        const key_T& key, std::size_t& offset)
+{
+    std::size_t dim_offset = key[0] - range.low[0];
+    if (dim_offset >= range.extent[0])
+    {
+        return false;
+    }
+    offset += dim_offset * range.stride[0];
+
+    return true;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_nd_range<N, key_T>::sc_map_nd_range() :
+        base(key_type(), key_type())
+{
+    init(NULL, this->start_key, this->end_key);
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_nd_range<N, key_T>::sc_map_nd_range(const key_type& start_key,
+        const key_type& end_key) :
+        base(start_key, end_key)
+{
+    init(NULL, start_key, end_key);
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_nd_range<N, key_T>::sc_map_nd_range(
+        const sc_map_range<key_type>* base_range, const key_type& start_key,
+        const key_type& end_key) :
+        base(start_key, end_key)
+{
+    init(base_range, start_key, end_key);
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+void sc_map_nd_range<N, key_T>::init(const sc_map_range<key_type>* base_range,
+        const key_type& start_key, const key_type& end_key)
+{
+    if ((base_range != NULL) &&
+        (!base_range->key_in_range(start_key) || !base_range->key_in_range(end_key)))
+    {
+        std::string message = "sub-range ";
+        start_key.append_string(message);
+        message += " to ";
+        end_key.append_string(message);
+        message += " is outside of the base range";
+        SC_REPORT_ERROR("sc_map_nd_range", message.c_str());
+    }
+
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        if (start_key[dim] <= end_key[dim])
+        {
+            dir[dim] = base::UP;
+            low[dim] = start_key[dim];
+            extent[dim] = end_key[dim] - start_key[dim] + 1;
+        }
+        else
+        {
+            dir[dim] = base::DOWN;
+            low[dim] = end_key[dim];
+            extent[dim] = start_key[dim] - end_key[dim] + 1;
+        }
+    }
+
+    stride[N-1] = 1;
+    for (unsigned int dim = N-1; dim > 0; --dim)
+    {
+        stride[dim-1] = stride[dim] * extent[dim];
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_nd_range<N, key_T>* sc_map_nd_range<N, key_T>::clone() const
+{
+    return new sc_map_nd_range(*this);
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_nd_range<N, key_T>::next_key(key_type& key) const
+{
+    return sc_map_nd_unroll<N-1>::next_key(*this, key);
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+std::size_t sc_map_nd_range<N, key_T>::size() const
+{
+    return extent[0] * stride[0];
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_nd_range<N, key_T>::key_in_range(const key_type& key) const
+{
+    std::size_t offset;
+
+    return storage_offset(key, offset);
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_nd_range<N, key_T>::index_of(const key_type& key,
+        std::size_t& index) const
+{
+    index = 0;
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        std::size_t dim_index;
+        if (dir[dim] == base::UP)
+        {
+            dim_index = key[dim] - this->start_key[dim];
+        }
+        else
+        {
+            dim_index = this->start_key[dim] - key[dim];
+        }
+
+        if (dim_index >= extent[dim])
+        {
+            return false;
+        }
+        index += dim_index * stride[dim];
+    }
+
+    return true;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+typename sc_map_nd_range<N, key_T>::key_type
+        sc_map_nd_range<N, key_T>::key_at(const std::size_t index) const
+{
+    key_type key;
+
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        index_type dim_index = static_cast<index_type>((index / stride[dim]) % extent[dim]);
+        if (dir[dim] == base::UP)
+        {
+            key.set(dim, this->start_key[dim] + dim_index);
+        }
+        else
+        {
+            key.set(dim, this->start_key[dim] - dim_index);
+        }
+    }
+
+    return key;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_nd_range<N, key_T>::shifted_key(const key_type& key,
+        const key_type& offset, const bool wrap, key_type& shifted) const
+{
+    shifted = key;
+
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        const index_type dim_extent = static_cast<index_type>(extent[dim]);
+        index_type dim_offset = key[dim] + offset[dim] - low[dim];
+
+        if (wrap)
+        {
+            dim_offset %= dim_extent;
+            if (dim_offset < 0)
+            {
+                dim_offset += dim_extent;
+            }
+        }
+        else if ((dim_offset < 0) || (dim_offset >= dim_extent))
+        {
+            return false;
+        }
+
+        shifted.set(dim, low[dim] + dim_offset);
+    }
+
+    return true;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_nd_range<N, key_T>::intersection(const sc_map_nd_range& other,
+        sc_map_nd_range& result) const
+{
+    index_type box_low[N];
+    index_type box_high[N];
+
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        const index_type high = low[dim] + static_cast<index_type>(extent[dim]) - 1;
+        const index_type other_high = other.low[dim] + static_cast<index_type>(other.extent[dim]) - 1;
+
+        box_low[dim] = (low[dim] > other.low[dim]) ? low[dim] : other.low[dim];
+        box_high[dim] = (high < other_high) ? high : other_high;
+        if (box_low[dim] > box_high[dim])
+        {
+            return false;
+        }
+    }
+
+    result = box(box_low, box_high);
+
+    return true;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+typename sc_map_nd_range<N, key_T>::range_vector_type
+        sc_map_nd_range<N, key_T>::difference(const sc_map_nd_range& other) const
+{
+    range_vector_type boxes;
+
+    sc_map_nd_range overlap;
+    if (!intersection(other, overlap))
+    {
+        boxes.push_back(*this);
+        return boxes;
+    }
+
+    index_type box_low[N];
+    index_type box_high[N];
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        box_low[dim] = low[dim];
+        box_high[dim] = low[dim] + static_cast<index_type>(extent[dim]) - 1;
+    }
+
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        const index_type overlap_low = overlap.low[dim];
+        const index_type overlap_high = overlap_low + static_cast<index_type>(overlap.extent[dim]) - 1;
+        const index_type slab_high = box_high[dim];
+
+        if (box_low[dim] < overlap_low)
+        {
+            box_high[dim] = overlap_low - 1;
+            boxes.push_back(box(box_low, box_high));
+        }
+        if (overlap_high < slab_high)
+        {
+            box_low[dim] = overlap_high + 1;
+            box_high[dim] = slab_high;
+            boxes.push_back(box(box_low, box_high));
+        }
+
+        box_low[dim] = overlap_low;
+        box_high[dim] = overlap_high;
+    }
+
+    return boxes;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_nd_range<N, key_T> sc_map_nd_range<N, key_T>::box(
+        const index_type (&box_low)[N], const index_type (&box_high)[N]) const
+{
+    key_type box_start = this->start_key;
+    key_type box_end = this->end_key;
+
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        if (dir[dim] == base::UP)
+        {
+            box_start.set(dim, box_low[dim]);
+            box_end.set(dim, box_high[dim]);
+        }
+        else
+        {
+            box_start.set(dim, box_high[dim]);
+            box_end.set(dim, box_low[dim]);
+        }
+    }
+
+    return sc_map_nd_range(box_start, box_end);
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+std::size_t sc_map_nd_range<N, key_T>::storage_size() const
+{
+    return extent[0] * stride[0];
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_nd_range<N, key_T>::storage_offset(const key_type& key,
+        std::size_t& offset) const
+{
+    offset = 0;
+
+    return sc_map_nd_unroll<N-1>::storage_offset(*this, key, offset);
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+typename sc_map_nd_range<N, key_T>::key_type
+        sc_map_nd_range<N, key_T>::storage_key(const std::size_t offset) const
+{
+    key_type key;
+
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        key.set(dim, low[dim] + static_cast<index_type>((offset / stride[dim]) % extent[dim]));
+    }
+
+    return key;
+}
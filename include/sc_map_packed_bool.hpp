@@ -0,0 +1,295 @@
+/*!
+ * @file sc_map_packed_bool.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Container of bool signals that are packed into words.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_base.hpp"
+#include <systemc.h>
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+//******************************************************************************
+
+/*!
+ * @brief Primitive channel that holds the values of a number of bool signals
+ *        in words of sc_dt::sc_digit.
+ *
+ * Writes go to the new value of the word that contains the bit. The channel
+ * requests only one update per delta cycle, in which the words that were
+ * written are compared and copied. Events are notified for the bits that
+ * changed. The events of a bit are created on the first request, so bits that
+ * nobody is sensitive to do not carry any event.
+ *
+ * The words are the only storage of the values. read() returns a reference
+ * to a constant with the current value of the bit. Traces need a reference
+ * that follows the value, which trace_value() provides. A byte per bit is
+ * only kept for this once the first bit of the bank is traced.
+ */
+class sc_map_bool_bank : public sc_prim_channel
+{
+public:
+    typedef sc_dt::sc_digit word_type;
+
+    sc_map_bool_bank(const char* name);
+    virtual ~sc_map_bool_bank();
+
+    /*!
+     * @brief Sets the number of bits of the bank, all bits are set to false.
+     */
+    void resize(const std::size_t bit_cnt);
+
+    std::size_t size() const;
+    std::size_t word_count() const;
+
+    const bool& read(const std::size_t bit) const;
+    void write(const std::size_t bit, const bool value);
+
+    /*!
+     * @brief Returns a reference to the value of a bit that is updated with
+     *        the bit, to be registered in a trace file.
+     */
+    const bool& trace_value(const std::size_t bit);
+
+    /*!
+     * @brief Returns the current value of a word, bit 0 of the word is the
+     *        bit at position word_id * SC_DIGIT_SIZE.
+     */
+    word_type read_word(const std::size_t word_id) const;
+
+    /*!
+     * @brief Writes the bits of a word that are selected by mask.
+     */
+    void write_word(const std::size_t word_id, const word_type value, const word_type mask);
+
+    /*!
+     * @brief Writes the bits of a bit vector a word at a time, bit 0 of the
+     *        vector to bit 0 of the bank. Bits beyond the bank are ignored.
+     */
+    void write_bits(const sc_bv_base& bits);
+
+    /*!
+     * @brief Reads the bits of the bank into a bit vector a word at a time,
+     *        bits of the vector beyond the bank are cleared.
+     */
+    void read_bits(sc_bv_base& bits) const;
+
+    bool event(const std::size_t bit) const;
+    const sc_event& value_changed_event(const std::size_t bit);
+    const sc_event& posedge_event(const std::size_t bit);
+    const sc_event& negedge_event(const std::size_t bit);
+
+protected:
+    virtual void update();
+
+private:
+    struct bit_value
+    {
+        bool value;
+    };
+
+    struct bit_events
+    {
+        sc_event value_changed;
+        sc_event posedge;
+        sc_event negedge;
+    };
+
+    std::size_t bit_cnt;
+    std::vector<word_type> current_words;
+    std::vector<word_type> new_words;
+    std::vector<word_type> changed_words;
+    std::vector<bool> dirty_flags;
+    std::vector<std::size_t> dirty_words;
+    std::vector<std::size_t> changed_word_ids;
+    sc_dt::uint64 change_delta;
+
+    static const bool bit_values[2];
+
+    std::vector<bit_value> traced_values;
+    std::vector<bit_events*> events;
+
+    void mark_dirty(const std::size_t word_id);
+    bit_events& get_events(const std::size_t bit);
+    void release_events();
+
+    sc_map_bool_bank(const sc_map_bool_bank&);
+    sc_map_bool_bank& operator=(const sc_map_bool_bank&);
+};
+
+//******************************************************************************
+
+/*!
+ * @brief Lightweight bool signal that represents one bit of an
+ *        sc_map_bool_bank.
+ *
+ * The proxy implements sc_signal_inout_if<bool>, so ports can be bound to it
+ * and processes can be made sensitive to it like to an sc_signal<bool>. It
+ * has no name and is not registered with the kernel. get_data_ref(), which
+ * sc_trace() uses, follows the value of the bit, whereas the reference
+ * returned by read() only holds the value at the time of the call.
+ */
+class sc_map_bool_proxy : public sc_signal_inout_if<bool>
+{
+public:
+    sc_map_bool_proxy(sc_map_bool_bank& bank, const std::size_t bit);
+    virtual ~sc_map_bool_proxy() {};
+
+    virtual const sc_event& default_event() const;
+    virtual const sc_event& value_changed_event() const;
+    virtual const sc_event& posedge_event() const;
+    virtual const sc_event& negedge_event() const;
+
+    virtual const bool& read() const;
+    virtual const bool& get_data_ref() const;
+    virtual bool event() const;
+    virtual bool posedge() const;
+    virtual bool negedge() const;
+
+    virtual void write(const bool& value);
+
+    operator const bool&() const;
+    sc_map_bool_proxy& operator=(const bool& value);
+
+    sc_map_bool_bank& get_bank() const;
+
+private:
+    sc_map_bool_bank* bank;
+    std::size_t bit;
+};
+
+//******************************************************************************
+void sc_trace(sc_trace_file* tf, const sc_map_bool_proxy& signal, const std::string& name);
+
+//******************************************************************************
+
+/*!
+ * @brief Container of bool signals that are stored in a single
+ *        sc_map_bool_bank.
+ *
+ * The elements are sc_map_bool_proxy objects, which offer the read, write,
+ * bind and sc_trace functions of sc_signal<bool>. The bits of the bank are
+ * assigned in the order of the range, so write_bits() and read_bits() copy
+ * whole words, also when called through sc_map_base. E.g. 4096 lanes are created by
+ * sc_map_packed_bool<sc_map_linear_range> lanes(sc_map_linear_range(0, 4095), "lanes");
+ *
+ * @tparam range_T Range type of the container.
+ */
+template <typename range_T>
+class sc_map_packed_bool : public sc_map_base<range_T, sc_map_bool_proxy>
+{
+public:
+    typedef sc_map_base<range_T, sc_map_bool_proxy> base;
+    typedef typename base::range_type range_type;
+    typedef typename base::key_type key_type;
+    typedef typename base::object_type object_type;
+
+    sc_map_packed_bool(const range_type& new_range, const sc_module_name name);
+    virtual ~sc_map_packed_bool() {};
+
+    const char* kind() const;
+
+    /*!
+     * @brief Constructs the proxies for consecutive bits of the bank.
+     */
+    class creator
+    {
+    public:
+        creator(sc_map_bool_bank& bank);
+        object_type* operator() (void* memory, const char* name, const key_type& id) const;
+
+    private:
+        sc_map_bool_bank* bank;
+        mutable std::size_t bit;
+    };
+
+private:
+    sc_map_bool_bank bank;
+};
+
+//******************************************************************************
+/*!
+ * @brief Copies a bit vector into the bank of a packed container and back a
+ *        word at a time, see sc_map_base::write_bits() and read_bits().
+ */
+template <typename range_T>
+void sc_map_write_bits(sc_map_base<range_T, sc_map_bool_proxy>& sc_map, const sc_bv_base& bits);
+template <typename range_T>
+void sc_map_read_bits(sc_map_base<range_T, sc_map_bool_proxy>& sc_map, sc_bv_base& bits);
+
+//******************************************************************************
+
+//******************************************************************************
+template <typename range_T>
+sc_map_packed_bool<range_T>::sc_map_packed_bool(const range_type& new_range,
+        const sc_module_name name) :
+        base(name),
+        bank((std::string(name) + "_bits").c_str())
+{
+    bank.resize(new_range.size());
+    this->init(new_range, creator(bank));
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T>
+const char* sc_map_packed_bool<range_T>::kind() const
+{
+    return ("sc_map_packed_bool");
+}
+
+//******************************************************************************
+template <typename range_T>
+sc_map_packed_bool<range_T>::creator::creator(sc_map_bool_bank& bank) :
+        bank(&bank),
+        bit(0)
+{}
+
+//******************************************************************************
+template <typename range_T>
+typename sc_map_packed_bool<range_T>::object_type*
+        sc_map_packed_bool<range_T>::creator::operator() (void* memory,
+        const char* name, const key_type& id) const
+{
+    return new (memory) object_type(*bank, bit++);
+}
+
+//******************************************************************************
+template <typename range_T>
+void sc_map_write_bits(sc_map_base<range_T, sc_map_bool_proxy>& sc_map,
+        const sc_bv_base& bits)
+{
+    typename sc_map_base<range_T, sc_map_bool_proxy>::iterator first_it = sc_map.begin();
+    if (first_it != sc_map.end())
+    {
+        first_it->get_bank().write_bits(bits);
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T>
+void sc_map_read_bits(sc_map_base<range_T, sc_map_bool_proxy>& sc_map,
+        sc_bv_base& bits)
+{
+    typename sc_map_base<range_T, sc_map_bool_proxy>::iterator first_it = sc_map.begin();
+    if (first_it != sc_map.end())
+    {
+        first_it->get_bank().read_bits(bits);
+    }
+
+    return;
+}
@@ -0,0 +1,402 @@
+/*!
+ * @file sc_map_packed_key.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Plain value key that packs the indexes of a regular key into 64-bit
+ *        words.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_regular_key.hpp"
+#include "sc_map_config.hpp"
+
+#include <systemc.h>
+
+#include <string>
+#include <sstream>
+#include <ostream>
+#include <functional>
+#include <limits>
+#include <cstdint>
+#include <type_traits>
+
+//******************************************************************************
+
+/*!
+ * @brief True if all types convert to an index, i.e. to int.
+ *
+ * Restricts the functions that take a list of indexes, so that a single key
+ * that converts to the packed key, e.g. sc_map_square_key, is passed to the
+ * functions that take a key.
+ */
+template <typename... index_T>
+struct sc_map_is_index_list;
+
+template <>
+struct sc_map_is_index_list<> : std::true_type
+{};
+
+template <typename index_T, typename... other_index_T>
+struct sc_map_is_index_list<index_T, other_index_T...> :
+        std::integral_constant<bool, std::is_convertible<index_T, int>::value
+                && sc_map_is_index_list<other_index_T...>::value>
+{};
+
+//******************************************************************************
+
+/*!
+ * @brief Non-virtual, trivially copyable key for N-dimensional regular
+ *        structures.
+ *
+ * Up to four indexes are stored within one 64-bit word, each index gets 64/N
+ * bits. Keys with more dimensions use 16 bits per index and as many words as
+ * needed. The indexes are stored with an offset of half their value range,
+ * the first index in the most significant bits of the first word. Therefore,
+ * the numerical order of the words is equal to the lexicographical order of
+ * the indexes and two keys with up to four dimensions are compared by a
+ * single integer comparison. The key has no virtual functions, it can be
+ * hashed and copied with memcpy().
+ *
+ * Indexes must lie within [min_index(), max_index()]. This covers the full
+ * range of index_type for one and two dimensions, [-2^20, 2^20-1] for three
+ * and [-32768, 32767] for four and more dimensions. The keys of sc_map_4d and
+ * of sc_map_nd with N >= 4 are therefore limited to indexes of 16 bits, while
+ * the polymorphic sc_map_4d_key holds any int. set() reports an error for
+ * indexes outside of this range instead of truncating them.
+ *
+ * sc_map_nd_key is this key, it is used by sc_map_nd and the containers
+ * derived from it, sc_map_square, sc_map_cube and sc_map_4d. The polymorphic
+ * keys sc_map_square_key, sc_map_cube_key and sc_map_4d_key convert
+ * implicitly from and to sc_map_packed_key. sc_map_linear_key converts with
+ * packed() and its explicit constructor.
+ *
+ * @tparam N Number of dimensions of the key.
+ */
+template <unsigned int N>
+class sc_map_packed_key
+{
+public:
+    typedef int index_type;
+    typedef std::uint64_t word_type;
+
+    static const unsigned int dimensions = N;
+    static const unsigned int field_bits = (N <= 4) ? 64 / N : 16;
+    static const unsigned int fields_per_word = 64 / field_bits;
+    static const unsigned int word_cnt = (N + fields_per_word - 1) / fields_per_word;
+
+    /*!
+     * @brief Comparision class, orders the keys within a std::map.
+     */
+    class Comperator
+    {
+    public:
+        bool operator()(const sc_map_packed_key& lhs, const sc_map_packed_key& rhs) const
+        {
+            return lhs < rhs;
+        }
+    };
+
+    /*!
+     * @brief The packed indexes.
+     */
+    word_type word[word_cnt];
+
+    /*!
+     * @brief Constructor: All indexes are set to 0.
+     */
+    sc_map_packed_key();
+
+    /*!
+     * @brief Constructor: Packs N indexes, the first one is the most
+     *        significant.
+     */
+    template <typename... index_T,
+              typename = typename std::enable_if<sc_map_is_index_list<index_T...>::value>::type>
+    explicit sc_map_packed_key(const index_T... indexes);
+
+    static index_type min_index();
+    static index_type max_index();
+
+    index_type get(const unsigned int dim) const;
+
+    /*!
+     * @brief Sets the index of a dimension. An index outside of
+     *        [min_index(), max_index()] is reported with SC_REPORT_ERROR and
+     *        leaves the key unchanged.
+     */
+    void set(const unsigned int dim, const index_type index);
+    index_type operator[](const unsigned int dim) const;
+
+    std::string get_string() const;
+    void append_string(std::string& buffer) const;
+
+    bool operator==(const sc_map_packed_key& other_key) const;
+    bool operator!=(const sc_map_packed_key& other_key) const;
+    bool operator<(const sc_map_packed_key& other_key) const;
+    bool operator>(const sc_map_packed_key& other_key) const;
+    bool operator<=(const sc_map_packed_key& other_key) const;
+    bool operator>=(const sc_map_packed_key& other_key) const;
+
+private:
+    static word_type field_mask();
+    static word_type field_bias();
+    static unsigned int field_word(const unsigned int dim);
+    static unsigned int field_shift(const unsigned int dim);
+};
+
+//******************************************************************************
+template <unsigned int N>
+std::ostream& operator<< (std::ostream& out, const sc_map_packed_key<N>& key);
+
+//******************************************************************************
+namespace std
+{
+template <unsigned int N>
+struct hash<sc_map_packed_key<N> >
+{
+    size_t operator()(const sc_map_packed_key<N>& key) const
+    {
+        size_t seed = 0;
+        for (unsigned int word_id = 0; word_id < sc_map_packed_key<N>::word_cnt; ++word_id)
+        {
+            seed ^= hash<typename sc_map_packed_key<N>::word_type>()(key.word[word_id])
+                    + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+
+        return seed;
+    }
+};
+}
+
+//******************************************************************************
+
+//******************************************************************************
+template <unsigned int N>
+sc_map_packed_key<N>::sc_map_packed_key()
+{
+    static_assert(N >= 1, "sc_map_packed_key needs at least one dimension");
+
+    for (unsigned int word_id = 0; word_id < word_cnt; ++word_id)
+    {
+        word[word_id] = 0;
+    }
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        set(dim, 0);
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N>
+template <typename... index_T, typename>
+sc_map_packed_key<N>::sc_map_packed_key(const index_T... indexes)
+{
+    static_assert(N >= 1, "sc_map_packed_key needs at least one dimension");
+    static_assert(sizeof...(index_T) == N, "sc_map_packed_key needs one index per dimension");
+
+    for (unsigned int word_id = 0; word_id < word_cnt; ++word_id)
+    {
+        word[word_id] = 0;
+    }
+
+    const index_type index_array[] = {static_cast<index_type>(indexes)...};
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        set(dim, index_array[dim]);
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline typename sc_map_packed_key<N>::word_type sc_map_packed_key<N>::field_mask()
+{
+    return (field_bits == 64) ? ~word_type(0) : ((word_type(1) << field_bits) - 1);
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline typename sc_map_packed_key<N>::word_type sc_map_packed_key<N>::field_bias()
+{
+    return word_type(1) << (field_bits - 1);
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline unsigned int sc_map_packed_key<N>::field_word(const unsigned int dim)
+{
+    return dim / fields_per_word;
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline unsigned int sc_map_packed_key<N>::field_shift(const unsigned int dim)
+{
+    return (fields_per_word - 1 - dim % fields_per_word) * field_bits;
+}
+
+//******************************************************************************
+template <unsigned int N>
+typename sc_map_packed_key<N>::index_type sc_map_packed_key<N>::min_index()
+{
+    if (field_bits >= 32)
+    {
+        return std::numeric_limits<index_type>::min();
+    }
+
+    return -static_cast<index_type>(field_bias());
+}
+
+//******************************************************************************
+template <unsigned int N>
+typename sc_map_packed_key<N>::index_type sc_map_packed_key<N>::max_index()
+{
+    if (field_bits >= 32)
+    {
+        return std::numeric_limits<index_type>::max();
+    }
+
+    return static_cast<index_type>(field_bias() - 1);
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline typename sc_map_packed_key<N>::index_type sc_map_packed_key<N>::get(
+        const unsigned int dim) const
+{
+    word_type field = (word[field_word(dim)] >> field_shift(dim)) & field_mask();
+
+    return static_cast<index_type>(static_cast<std::int64_t>(field - field_bias()));
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline void sc_map_packed_key<N>::set(const unsigned int dim, const index_type index)
+{
+    if ((index < min_index()) || (index > max_index()))
+    {
+        std::stringstream message;
+        message << "index " << index << " of dimension " << dim
+                << " is outside of [" << min_index() << ", " << max_index() << "]";
+        SC_REPORT_ERROR("sc_map_packed_key", message.str().c_str());
+        return;
+    }
+
+    word_type field = (static_cast<word_type>(static_cast<std::int64_t>(index)) + field_bias()) & field_mask();
+
+    word[field_word(dim)] &= ~(field_mask() << field_shift(dim));
+    word[field_word(dim)] |= field << field_shift(dim);
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline typename sc_map_packed_key<N>::index_type sc_map_packed_key<N>::operator[](
+        const unsigned int dim) const
+{
+    return get(dim);
+}
+
+//******************************************************************************
+template <unsigned int N>
+std::string sc_map_packed_key<N>::get_string() const
+{
+    std::string key_string;
+    append_string(key_string);
+
+    return key_string;
+}
+
+//******************************************************************************
+template <unsigned int N>
+void sc_map_packed_key<N>::append_string(std::string& buffer) const
+{
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        if (dim != 0)
+        {
+            buffer += sc_map::key_sub_separator_char;
+        }
+        sc_map_regular_key::append_index(buffer, get(dim));
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline bool sc_map_packed_key<N>::operator==(const sc_map_packed_key& other_key) const
+{
+    for (unsigned int word_id = 0; word_id < word_cnt; ++word_id)
+    {
+        if (word[word_id] != other_key.word[word_id])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline bool sc_map_packed_key<N>::operator!=(const sc_map_packed_key& other_key) const
+{
+    return !(*this == other_key);
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline bool sc_map_packed_key<N>::operator<(const sc_map_packed_key& other_key) const
+{
+    for (unsigned int word_id = 0; word_id < word_cnt - 1; ++word_id)
+    {
+        if (word[word_id] != other_key.word[word_id])
+        {
+            return word[word_id] < other_key.word[word_id];
+        }
+    }
+
+    return word[word_cnt - 1] < other_key.word[word_cnt - 1];
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline bool sc_map_packed_key<N>::operator>(const sc_map_packed_key& other_key) const
+{
+    return other_key < *this;
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline bool sc_map_packed_key<N>::operator<=(const sc_map_packed_key& other_key) const
+{
+    return !(other_key < *this);
+}
+
+//******************************************************************************
+template <unsigned int N>
+inline bool sc_map_packed_key<N>::operator>=(const sc_map_packed_key& other_key) const
+{
+    return !(*this < other_key);
+}
+
+//******************************************************************************
+template <unsigned int N>
+std::ostream& operator<< (std::ostream& out, const sc_map_packed_key<N>& key)
+{
+    out << key.get_string();
+
+    return out;
+}
@@ -0,0 +1,729 @@
+/*!
+ * @file sc_map_pattern_range.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Ranges that select a regular pattern of keys within a box: strided,
+ *        tiled and checkerboard ranges.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_range.hpp"
+#include "sc_map_nd_key.hpp"
+
+#include <cstddef>
+
+//******************************************************************************
+
+/*!
+ * @brief Range over every k-th key of a box, with its own step per dimension.
+ *
+ * Every dimension runs from start_key towards end_key, upwards or downwards,
+ * in steps of step. If end_key is not reached exactly, the last key of the
+ * dimension is the last one before end_key. The last dimension changes
+ * fastest. Stepping, size(), key_in_range(), index_of() and key_at() are
+ * calculated from the indexes, no keys are stored.
+ *
+ * The range can be used with the iterators of all containers with the same
+ * key type, e.g. sc_map_strided_range<1, sc_map_linear_key>(0, 15, 2) selects
+ * the even lanes of a sc_map_linear container with 16 elements.
+ *
+ * @tparam N Number of dimensions.
+ * @tparam key_T Key type, which has to provide operator[].
+ */
+template <unsigned int N, typename key_T = sc_map_nd_key<N> >
+class sc_map_strided_range : public sc_map_range<key_T>
+{
+public:
+    typedef sc_map_range<key_T> base;
+    typedef typename base::key_type key_type;
+    typedef typename key_type::index_type index_type;
+
+    static const unsigned int dimensions = N;
+
+    sc_map_strided_range(const key_type& start_key, const key_type& end_key, const std::size_t step = 1);
+    sc_map_strided_range(const key_type& start_key, const key_type& end_key, const std::size_t (&steps)[N]);
+    virtual ~sc_map_strided_range() {};
+
+    virtual sc_map_strided_range* clone() const;
+
+    virtual key_type first() const;
+    virtual key_type last() const;
+
+    virtual bool next_key(key_type& key) const;
+
+    virtual std::size_t size() const;
+    virtual bool key_in_range(const key_type& key) const;
+
+    /*!
+     * @brief Calculates the position of a key in the order given by
+     *        next_key(), start_key is at position 0.
+     */
+    bool index_of(const key_type& key, std::size_t& index) const;
+    key_type key_at(const std::size_t index) const;
+
+protected:
+    key_type start_key;
+    key_type last_key;
+    index_type delta[N];
+    std::size_t count[N];
+    std::size_t stride[N];
+
+    /*!
+     * @brief Calculates the position of an index within a dimension.
+     *
+     * @return false if the index is not part of the dimension.
+     */
+    bool position_of(const unsigned int dim, const index_type index, std::size_t& position) const;
+
+private:
+    void init(const key_type& end_key, const std::size_t (&steps)[N]);
+};
+
+//******************************************************************************
+
+/*!
+ * @brief Range over all keys of a box, traversed tile by tile.
+ *
+ * The box is split into tiles with tile_extents keys per dimension, the tiles
+ * at the upper end of the box can be smaller. The tiles are visited in the
+ * order of their first keys, all keys of a tile are visited before the next
+ * tile. Each step only compares and sets indexes of the current key.
+ * index_of() and key_at() count the keys in the same order.
+ *
+ * @tparam N Number of dimensions.
+ * @tparam key_T Key type, which has to provide operator[].
+ */
+template <unsigned int N, typename key_T = sc_map_nd_key<N> >
+class sc_map_tiled_range : public sc_map_strided_range<N, key_T>
+{
+public:
+    typedef sc_map_strided_range<N, key_T> base;
+    typedef typename base::key_type key_type;
+    typedef typename base::index_type index_type;
+
+    sc_map_tiled_range(const key_type& start_key, const key_type& end_key, const std::size_t tile_extent);
+    sc_map_tiled_range(const key_type& start_key, const key_type& end_key, const std::size_t (&tile_extents)[N]);
+    virtual ~sc_map_tiled_range() {};
+
+    virtual sc_map_tiled_range* clone() const;
+
+    virtual bool next_key(key_type& key) const;
+
+    /*!
+     * @brief Calculates the position of a key in the order given by
+     *        next_key(), i.e. tile by tile, start_key is at position 0.
+     */
+    bool index_of(const key_type& key, std::size_t& index) const;
+    key_type key_at(const std::size_t index) const;
+
+private:
+    std::size_t tile[N];
+
+    /*!
+     * @brief Returns the number of keys of the tile starting at tile_first
+     *        within a dimension, which is smaller than the tile extent for
+     *        the last tile of the dimension.
+     */
+    std::size_t tile_extent(const unsigned int dim, const std::size_t tile_first) const;
+};
+
+//******************************************************************************
+
+/*!
+ * @brief Range over the keys of a box whose sum of positions is even or odd.
+ *
+ * The positions are counted from start_key. With parity 0 the range contains
+ * start_key and every key that is an even number of unit steps away from it,
+ * with parity 1 the others. For a single dimension these are the even and odd
+ * elements. As neighboring keys alternate, next_key() takes at most three
+ * steps of the underlying box. A box with a single key and parity 1 is empty,
+ * iterators over it start at the end.
+ *
+ * @tparam N Number of dimensions.
+ * @tparam key_T Key type, which has to provide operator[].
+ */
+template <unsigned int N, typename key_T = sc_map_nd_key<N> >
+class sc_map_checkerboard_range : public sc_map_strided_range<N, key_T>
+{
+public:
+    typedef sc_map_strided_range<N, key_T> base;
+    typedef typename base::key_type key_type;
+    typedef typename base::index_type index_type;
+
+    sc_map_checkerboard_range(const key_type& start_key, const key_type& end_key, const unsigned int parity = 0);
+    virtual ~sc_map_checkerboard_range() {};
+
+    virtual sc_map_checkerboard_range* clone() const;
+
+    virtual key_type first() const;
+    virtual key_type last() const;
+
+    virtual bool next_key(key_type& key) const;
+
+    virtual std::size_t size() const;
+    virtual bool empty() const;
+    virtual bool key_in_range(const key_type& key) const;
+
+    /*!
+     * @brief Calculates the position of a key in the order given by
+     *        next_key(), first() is at position 0.
+     */
+    bool index_of(const key_type& key, std::size_t& index) const;
+    key_type key_at(const std::size_t index) const;
+
+private:
+    unsigned int parity;
+
+    bool has_parity(const key_type& key) const;
+
+    /*!
+     * @brief Returns the number of keys with the given parity in the box that
+     *        is spanned by the dimensions after dim.
+     */
+    std::size_t inner_count(const unsigned int dim, const unsigned int key_parity) const;
+};
+
+//******************************************************************************
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_strided_range<N, key_T>::sc_map_strided_range(const key_type& start_key,
+        const key_type& end_key, const std::size_t step) :
+        start_key(start_key),
+        last_key(start_key)
+{
+    std::size_t steps[N];
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        steps[dim] = step;
+    }
+
+    init(end_key, steps);
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_strided_range<N, key_T>::sc_map_strided_range(const key_type& start_key,
+        const key_type& end_key, const std::size_t (&steps)[N]) :
+        start_key(start_key),
+        last_key(start_key)
+{
+    init(end_key, steps);
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+void sc_map_strided_range<N, key_T>::init(const key_type& end_key,
+        const std::size_t (&steps)[N])
+{
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        const std::size_t step = (steps[dim] == 0) ? 1 : steps[dim];
+        std::size_t span;
+        if (start_key[dim] <= end_key[dim])
+        {
+            span = end_key[dim] - start_key[dim];
+            delta[dim] = static_cast<index_type>(step);
+        }
+        else
+        {
+            span = start_key[dim] - end_key[dim];
+            delta[dim] = -static_cast<index_type>(step);
+        }
+
+        count[dim] = span / step + 1;
+        last_key.set(dim, start_key[dim] + static_cast<index_type>(count[dim] - 1) * delta[dim]);
+    }
+
+    stride[N-1] = 1;
+    for (unsigned int dim = N-1; dim > 0; --dim)
+    {
+        stride[dim-1] = stride[dim] * count[dim];
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_strided_range<N, key_T>* sc_map_strided_range<N, key_T>::clone() const
+{
+    return new sc_map_strided_range(*this);
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+typename sc_map_strided_range<N, key_T>::key_type
+        sc_map_strided_range<N, key_T>::first() const
+{
+    return start_key;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+typename sc_map_strided_range<N, key_T>::key_type
+        sc_map_strided_range<N, key_T>::last() const
+{
+    return last_key;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_strided_range<N, key_T>::next_key(key_type& key) const
+{
+    for (unsigned int dim = N; dim > 0; --dim)
+    {
+        if (key[dim-1] != last_key[dim-1])
+        {
+            key.set(dim-1, key[dim-1] + delta[dim-1]);
+            for (unsigned int inner_dim = dim; inner_dim < N; ++inner_dim)
+            {
+                key.set(inner_dim, start_key[inner_dim]);
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+std::size_t sc_map_strided_range<N, key_T>::size() const
+{
+    return count[0] * stride[0];
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_strided_range<N, key_T>::key_in_range(const key_type& key) const
+{
+    std::size_t index;
+
+    return index_of(key, index);
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_strided_range<N, key_T>::position_of(const unsigned int dim,
+        const index_type index, std::size_t& position) const
+{
+    index_type distance = index - start_key[dim];
+    if ((distance % delta[dim]) != 0)
+    {
+        return false;
+    }
+
+    index_type signed_position = distance / delta[dim];
+    if (signed_position < 0)
+    {
+        return false;
+    }
+
+    position = static_cast<std::size_t>(signed_position);
+
+    return position < count[dim];
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_strided_range<N, key_T>::index_of(const key_type& key,
+        std::size_t& index) const
+{
+    index = 0;
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        std::size_t position;
+        if (!position_of(dim, key[dim], position))
+        {
+            return false;
+        }
+        index += position * stride[dim];
+    }
+
+    return true;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+typename sc_map_strided_range<N, key_T>::key_type
+        sc_map_strided_range<N, key_T>::key_at(const std::size_t index) const
+{
+    key_type key = start_key;
+
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        index_type position = static_cast<index_type>((index / stride[dim]) % count[dim]);
+        key.set(dim, start_key[dim] + position * delta[dim]);
+    }
+
+    return key;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_tiled_range<N, key_T>::sc_map_tiled_range(const key_type& start_key,
+        const key_type& end_key, const std::size_t tile_extent) :
+        base(start_key, end_key)
+{
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        tile[dim] = (tile_extent == 0) ? 1 : tile_extent;
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_tiled_range<N, key_T>::sc_map_tiled_range(const key_type& start_key,
+        const key_type& end_key, const std::size_t (&tile_extents)[N]) :
+        base(start_key, end_key)
+{
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        tile[dim] = (tile_extents[dim] == 0) ? 1 : tile_extents[dim];
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_tiled_range<N, key_T>* sc_map_tiled_range<N, key_T>::clone() const
+{
+    return new sc_map_tiled_range(*this);
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_tiled_range<N, key_T>::next_key(key_type& key) const
+{
+    std::size_t position[N];
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        this->position_of(dim, key[dim], position[dim]);
+    }
+
+    // next key within the current tile
+    for (unsigned int dim = N; dim > 0; --dim)
+    {
+        const unsigned int d = dim - 1;
+        std::size_t tile_last = (position[d] / tile[d]) * tile[d] + tile[d] - 1;
+        if (tile_last >= this->count[d])
+        {
+            tile_last = this->count[d] - 1;
+        }
+
+        if (position[d] != tile_last)
+        {
+            key.set(d, key[d] + this->delta[d]);
+            for (unsigned int inner_dim = dim; inner_dim < N; ++inner_dim)
+            {
+                std::size_t tile_first = (position[inner_dim] / tile[inner_dim]) * tile[inner_dim];
+                key.set(inner_dim, this->start_key[inner_dim] + static_cast<index_type>(tile_first) * this->delta[inner_dim]);
+            }
+
+            return true;
+        }
+    }
+
+    // first key of the next tile
+    for (unsigned int dim = N; dim > 0; --dim)
+    {
+        const unsigned int d = dim - 1;
+        std::size_t next_tile_first = (position[d] / tile[d] + 1) * tile[d];
+
+        if (next_tile_first < this->count[d])
+        {
+            for (unsigned int outer_dim = 0; outer_dim < d; ++outer_dim)
+            {
+                std::size_t tile_first = (position[outer_dim] / tile[outer_dim]) * tile[outer_dim];
+                key.set(outer_dim, this->start_key[outer_dim] + static_cast<index_type>(tile_first) * this->delta[outer_dim]);
+            }
+            key.set(d, this->start_key[d] + static_cast<index_type>(next_tile_first) * this->delta[d]);
+            for (unsigned int inner_dim = dim; inner_dim < N; ++inner_dim)
+            {
+                key.set(inner_dim, this->start_key[inner_dim]);
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+std::size_t sc_map_tiled_range<N, key_T>::tile_extent(const unsigned int dim,
+        const std::size_t tile_first) const
+{
+    const std::size_t remaining = this->count[dim] - tile_first;
+
+    return (remaining < tile[dim]) ? remaining : tile[dim];
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_tiled_range<N, key_T>::index_of(const key_type& key,
+        std::size_t& index) const
+{
+    std::size_t position[N];
+    std::size_t tile_first[N];
+    std::size_t extent[N];
+
+    // keys of the tiles before the current one: in each dimension, the tiles
+    // with a lower position cover the current tile of the outer dimensions
+    // and the whole box in the inner dimensions
+    index = 0;
+    std::size_t outer_extent = 1;
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        if (!this->position_of(dim, key[dim], position[dim]))
+        {
+            return false;
+        }
+
+        tile_first[dim] = (position[dim] / tile[dim]) * tile[dim];
+        extent[dim] = tile_extent(dim, tile_first[dim]);
+        index += outer_extent * tile_first[dim] * this->stride[dim];
+        outer_extent *= extent[dim];
+    }
+
+    std::size_t tile_offset = 0;
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        tile_offset = tile_offset * extent[dim] + (position[dim] - tile_first[dim]);
+    }
+    index += tile_offset;
+
+    return true;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+typename sc_map_tiled_range<N, key_T>::key_type
+        sc_map_tiled_range<N, key_T>::key_at(const std::size_t index) const
+{
+    std::size_t tile_first[N];
+    std::size_t extent[N];
+
+    std::size_t remaining = index;
+    std::size_t outer_extent = 1;
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        const std::size_t tile_keys = outer_extent * tile[dim] * this->stride[dim];
+        tile_first[dim] = (remaining / tile_keys) * tile[dim];
+        remaining %= tile_keys;
+        extent[dim] = tile_extent(dim, tile_first[dim]);
+        outer_extent *= extent[dim];
+    }
+
+    key_type key = this->start_key;
+    for (unsigned int dim = N; dim > 0; --dim)
+    {
+        const unsigned int d = dim - 1;
+        const std::size_t position = tile_first[d] + remaining % extent[d];
+        key.set(d, this->start_key[d] + static_cast<index_type>(position) * this->delta[d]);
+        remaining /= extent[d];
+    }
+
+    return key;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_checkerboard_range<N, key_T>::sc_map_checkerboard_range(
+        const key_type& start_key, const key_type& end_key,
+        const unsigned int parity) :
+        base(start_key, end_key),
+        parity(parity % 2)
+{}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+sc_map_checkerboard_range<N, key_T>*
+        sc_map_checkerboard_range<N, key_T>::clone() const
+{
+    return new sc_map_checkerboard_range(*this);
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_checkerboard_range<N, key_T>::has_parity(const key_type& key) const
+{
+    std::size_t position_sum = 0;
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        index_type distance = key[dim] - this->start_key[dim];
+        position_sum += static_cast<std::size_t>((distance < 0) ? -distance : distance);
+    }
+
+    return (position_sum % 2) == parity;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+typename sc_map_checkerboard_range<N, key_T>::key_type
+        sc_map_checkerboard_range<N, key_T>::first() const
+{
+    key_type key = this->start_key;
+    if (!has_parity(key) && !empty())
+    {
+        base::next_key(key);
+    }
+
+    return key;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+typename sc_map_checkerboard_range<N, key_T>::key_type
+        sc_map_checkerboard_range<N, key_T>::last() const
+{
+    if (has_parity(this->last_key) || empty())
+    {
+        return this->last_key;
+    }
+
+    return key_at(size() - 1);
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_checkerboard_range<N, key_T>::next_key(key_type& key) const
+{
+    do
+    {
+        if (!base::next_key(key))
+        {
+            return false;
+        }
+    } while (!has_parity(key));
+
+    return true;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+std::size_t sc_map_checkerboard_range<N, key_T>::size() const
+{
+    // The number of even keys exceeds the number of odd keys by one if all
+    // dimensions have an odd number of keys, otherwise both are equal.
+    std::size_t excess = 1;
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        excess &= this->count[dim];
+    }
+
+    const std::size_t box_size = base::size();
+    if (parity == 0)
+    {
+        return (box_size + excess) / 2;
+    }
+
+    return (box_size - excess) / 2;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_checkerboard_range<N, key_T>::empty() const
+{
+    return size() == 0;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_checkerboard_range<N, key_T>::key_in_range(const key_type& key) const
+{
+    return base::key_in_range(key) && has_parity(key);
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+std::size_t sc_map_checkerboard_range<N, key_T>::inner_count(
+        const unsigned int dim, const unsigned int key_parity) const
+{
+    std::size_t excess = 1;
+    for (unsigned int inner_dim = dim + 1; inner_dim < N; ++inner_dim)
+    {
+        excess &= this->count[inner_dim];
+    }
+
+    const std::size_t box_size = this->stride[dim];
+    if (key_parity == 0)
+    {
+        return (box_size + excess) / 2;
+    }
+
+    return (box_size - excess) / 2;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+bool sc_map_checkerboard_range<N, key_T>::index_of(const key_type& key,
+        std::size_t& index) const
+{
+    if (!key_in_range(key))
+    {
+        return false;
+    }
+
+    // The keys before the key's position in a dimension form full boxes of
+    // the inner dimensions, whose required parity alternates.
+    index = 0;
+    unsigned int key_parity = parity;
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        std::size_t position;
+        this->position_of(dim, key[dim], position);
+
+        index += ((position + 1) / 2) * inner_count(dim, key_parity)
+                + (position / 2) * inner_count(dim, 1 - key_parity);
+        key_parity = (key_parity + position) % 2;
+    }
+
+    return true;
+}
+
+//******************************************************************************
+template <unsigned int N, typename key_T>
+typename sc_map_checkerboard_range<N, key_T>::key_type
+        sc_map_checkerboard_range<N, key_T>::key_at(const std::size_t index) const
+{
+    key_type key = this->start_key;
+
+    std::size_t remaining = index;
+    unsigned int key_parity = parity;
+    for (unsigned int dim = 0; dim < N; ++dim)
+    {
+        const std::size_t same_cnt = inner_count(dim, key_parity);
+        const std::size_t pair_cnt = remaining / this->stride[dim];
+        remaining %= this->stride[dim];
+
+        std::size_t position = 2 * pair_cnt;
+        if (remaining >= same_cnt)
+        {
+            remaining -= same_cnt;
+            ++position;
+        }
+
+        key.set(dim, this->start_key[dim] + static_cast<index_type>(position) * this->delta[dim]);
+        key_parity = (key_parity + position) % 2;
+    }
+
+    return key;
+}
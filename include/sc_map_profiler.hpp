@@ -0,0 +1,168 @@
+/*!
+ * @file sc_map_profiler.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Timing of the elaboration operations of the sc_map containers.
+ *
+ * The timers are opt-in: the operations of the containers are only timed if
+ * the library and the model are compiled with SC_MAP_PROFILER defined.
+ * Otherwise SC_MAP_PROFILE() expands to nothing.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include <systemc.h>
+
+#include <chrono>
+#include <map>
+#include <vector>
+#include <string>
+#include <utility>
+#include <ostream>
+#include <cstddef>
+
+//******************************************************************************
+#ifdef SC_MAP_PROFILER
+    #define SC_MAP_PROFILE_CONCAT(a, b) a ## b
+    #define SC_MAP_PROFILE_NAME(line) SC_MAP_PROFILE_CONCAT(sc_map_profile_timer_, line)
+    #define SC_MAP_PROFILE(map_name, operation) \
+            sc_map_scoped_timer SC_MAP_PROFILE_NAME(__LINE__)(map_name, operation, true)
+    #define SC_MAP_PROFILE_UNTRACED(map_name, operation) \
+            sc_map_scoped_timer SC_MAP_PROFILE_NAME(__LINE__)(map_name, operation, false)
+#else
+    #define SC_MAP_PROFILE(map_name, operation)
+    #define SC_MAP_PROFILE_UNTRACED(map_name, operation)
+#endif
+
+//******************************************************************************
+
+/*!
+ * @brief Collects the time spent in the operations of each sc_map.
+ *
+ * The times are aggregated per container name and operation. Operations that
+ * are timed with tracing enabled are additionally kept as events for a
+ * timeline, which is written in the Chrome trace format and can be opened
+ * with chrome://tracing or Perfetto. Operations that run once per element,
+ * like the creator, are only aggregated.
+ *
+ * Nested operations are recorded separately, e.g. bind(map) contains the
+ * time of the bind(iterator) it calls.
+ */
+class sc_map_profiler
+{
+public:
+    typedef std::chrono::steady_clock clock_type;
+
+    struct operation_record
+    {
+        std::string map_name;
+        std::string operation;
+        std::size_t call_cnt;
+        double total_ns;
+        double max_ns;
+
+        operation_record();
+    };
+
+    typedef std::vector<operation_record> record_vector_type;
+
+    sc_map_profiler();
+
+    void record(const char* map_name, const char* operation,
+            const clock_type::time_point& start, const clock_type::time_point& stop,
+            const bool trace);
+
+    /*!
+     * @brief Returns the aggregated records sorted by their total time.
+     */
+    record_vector_type get_records() const;
+
+    std::string get_result() const;
+    void print_report() const;
+    void write_summary(std::ostream& output) const;
+    void write_chrome_trace(std::ostream& output) const;
+    bool write_chrome_trace(const std::string& file_name) const;
+
+private:
+    struct trace_event
+    {
+        std::string name;
+        const char* operation;
+        double start_us;
+        double duration_us;
+    };
+
+    typedef std::pair<std::string, std::string> record_key_type;
+
+    clock_type::time_point start_time;
+    std::map<record_key_type, operation_record> records;
+    std::vector<trace_event> events;
+
+    std::string last_map_name;
+    const char* last_operation;
+    operation_record* last_record;
+};
+
+//******************************************************************************
+
+/*!
+ * @brief Times the scope it is declared in and records it to
+ *        elaboration_profile.
+ */
+class sc_map_scoped_timer
+{
+public:
+    sc_map_scoped_timer(const char* map_name, const char* operation, const bool trace);
+    ~sc_map_scoped_timer();
+
+private:
+    const char* map_name;
+    const char* operation;
+    bool trace;
+    sc_map_profiler::clock_type::time_point start;
+
+    sc_map_scoped_timer(const sc_map_scoped_timer&);
+    sc_map_scoped_timer& operator=(const sc_map_scoped_timer&);
+};
+
+//******************************************************************************
+
+/*!
+ * @brief Module that writes the summary of elaboration_profile to the
+ *        console and the timeline to a file at the end of elaboration.
+ */
+class sc_map_profiler_report : public sc_module
+{
+public:
+    sc_map_profiler_report(sc_module_name _name, const std::string& trace_file_name);
+
+    virtual void end_of_elaboration();
+
+private:
+    std::string trace_file_name;
+};
+
+//******************************************************************************
+extern sc_map_profiler elaboration_profile;
+
+//******************************************************************************
+inline sc_map_scoped_timer::sc_map_scoped_timer(const char* map_name,
+        const char* operation, const bool trace) :
+        map_name(map_name),
+        operation(operation),
+        trace(trace),
+        start(sc_map_profiler::clock_type::now())
+{}
+
+//******************************************************************************
+inline sc_map_scoped_timer::~sc_map_scoped_timer()
+{
+    elaboration_profile.record(map_name, operation, start,
+            sc_map_profiler::clock_type::now(), trace);
+}
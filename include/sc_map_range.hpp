@@ -19,6 +19,7 @@
 #include <vector>
 #include <functional>
 #include <ostream>
+#include <cstddef>
 
 //******************************************************************************
 template <typename key_T>
@@ -30,6 +31,8 @@ public:
 
     enum direction{UP, DOWN};
 
+    static const bool dense_storage = false;
+
     virtual ~sc_map_range() {};
 
     virtual sc_map_range* clone() const =0;
@@ -37,17 +40,62 @@ public:
     virtual key_type first() const =0;
     virtual key_type last() const =0;
 
+    virtual std::size_t size() const;
+
+    /*!
+     * @brief Returns true if the range contains no key, first() and last()
+     *        are not valid keys in this case. Only ranges that select keys by
+     *        a pattern or a list can be empty.
+     */
+    virtual bool empty() const;
     virtual bool key_in_range(const key_type& key) const;
     virtual bool next_key(key_type& key) const =0;
     virtual key_vector_type get_key_vector() const;
+
+    /*!
+     * @brief Returns the memory the range allocated on the heap, in addition
+     *        to the size of the range object.
+     */
+    virtual std::size_t heap_size() const;
 };
 
 //******************************************************************************
 
+//******************************************************************************
+template <typename key_T>
+std::size_t sc_map_range<key_T>::size() const
+{
+    std::size_t key_cnt = 0;
+    if (empty())
+    {
+        return key_cnt;
+    }
+
+    key_type key = first();
+    do
+    {
+        ++key_cnt;
+    } while (next_key(key));
+
+    return key_cnt;
+}
+
+//******************************************************************************
+template <typename key_T>
+bool sc_map_range<key_T>::empty() const
+{
+    return false;
+}
+
 //******************************************************************************
 template <typename key_T>
 bool sc_map_range<key_T>::key_in_range(const key_type& key) const
 {
+    if (empty())
+    {
+        return false;
+    }
+
     key_type range_key = first();
     do
     {
@@ -66,6 +114,11 @@ typename sc_map_range<key_T>::key_vector_type
         sc_map_range<key_T>::get_key_vector() const
 {
     key_vector_type key_vector;
+    if (empty())
+    {
+        return key_vector;
+    }
+    key_vector.reserve(size());
 
     key_type key = first();
     do
@@ -75,3 +128,10 @@ typename sc_map_range<key_T>::key_vector_type
 
     return key_vector;
 }
+
+//******************************************************************************
+template <typename key_T>
+std::size_t sc_map_range<key_T>::heap_size() const
+{
+    return 0;
+}
@@ -15,6 +15,10 @@
 
 #include "sc_map_key.hpp"
 
+#include <string>
+#include <functional>
+#include <cstddef>
+
 //******************************************************************************
 class sc_map_regular_key : public sc_map_key
 {
@@ -28,6 +32,23 @@ public:
 
     virtual std::string get_string() const =0;
 
+    static void append_index(std::string& buffer, const index_type index);
+
+    /*!
+     * @brief Combines the hash of an index with the hash of the preceding
+     *        indexes of a key.
+     */
+    static std::size_t combine_hash(const std::size_t seed, const index_type index);
+
     virtual bool operator==(const sc_map_key& other_key) const =0;
     virtual bool operator<(const sc_map_key& other_key) const =0;
 };
+
+//******************************************************************************
+
+//******************************************************************************
+inline std::size_t sc_map_regular_key::combine_hash(const std::size_t seed,
+        const index_type index)
+{
+    return seed ^ (std::hash<index_type>()(index) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
@@ -14,15 +14,27 @@
 #pragma once
 
 #include <vector>
+#include <cstddef>
 #include "sc_map_range.hpp"
 
 //******************************************************************************
+
+/*!
+ * @brief Base class of the ranges that span a box of keys.
+ *
+ * As all keys within the box exist, containers with a regular range use the
+ * dense storage of sc_map_storage. Derived classes therefore provide the
+ * functions storage_size(), storage_offset() and storage_key() that map the
+ * keys of the box to a flat, strided index in ascending key order.
+ */
 template <typename key_T>
 class sc_map_regular_range : public sc_map_range<key_T>
 {
 public:
     typedef key_T key_type;
 
+    static const bool dense_storage = true;
+
     sc_map_regular_range(const key_type& start_key, const key_type& end_key);
     virtual ~sc_map_regular_range() {};
 
@@ -0,0 +1,162 @@
+/*!
+ * @file sc_map_shift.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Binding of regular containers with a constant key offset.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_profiler.hpp"
+
+#include <systemc.h>
+
+#include <vector>
+
+template <typename range_T, typename object_T>
+class sc_map_base;
+
+//******************************************************************************
+
+/*!
+ * @brief Container of ports whose keys are shifted by a constant offset for
+ *        binding.
+ *
+ * Returned by sc_map_nd::shift(). Binding it to a signal container binds the
+ * port with key k to the signal with key k+offset, e.g.
+ * ports.shift(0,+1).bind(signals) connects every port to the signal of its
+ * eastern neighbor. The ports are visited in the order of their range and
+ * the signals are looked up by offset, so a whole mesh is wired in a single
+ * pass.
+ *
+ * Without wrap-around the ports at the border, whose shifted key lies outside
+ * of the signal container, stay unbound and are returned to the caller, so
+ * that they can be bound to boundary signals. With wrap() the shifted keys
+ * re-enter the signal container on the opposite side, as in a torus.
+ *
+ * @tparam range_T Range type of the containers, must provide shifted_key().
+ * @tparam object_T Type of the ports.
+ */
+template <typename range_T, typename object_T>
+class sc_map_shift
+{
+public:
+    typedef sc_map_base<range_T, object_T> map_type;
+    typedef range_T range_type;
+    typedef typename range_type::key_type key_type;
+    typedef std::vector<key_type> key_vector_type;
+
+    sc_map_shift(map_type& sc_map, const key_type& offset);
+
+    /*!
+     * @brief Returns the same shift with wrap-around at the borders.
+     */
+    sc_map_shift wrap() const;
+
+    /*!
+     * @brief Binds each port to the signal at the shifted key.
+     *
+     * @param signal_map Container with the signals.
+     * @return Keys of the ports for which no signal was found.
+     */
+    template <typename signal_T>
+    key_vector_type bind(sc_map_base<range_type, signal_T>& signal_map) const;
+    template <typename signal_T>
+    key_vector_type operator()(sc_map_base<range_type, signal_T>& signal_map) const;
+
+    const key_type& get_offset() const;
+    bool is_wrapped() const;
+
+private:
+    map_type* map;
+    key_type offset;
+    bool wrapped;
+};
+
+//******************************************************************************
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_shift<range_T, object_T>::sc_map_shift(map_type& sc_map,
+        const key_type& offset) :
+        map(&sc_map),
+        offset(offset),
+        wrapped(false)
+{}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_shift<range_T, object_T> sc_map_shift<range_T, object_T>::wrap() const
+{
+    sc_map_shift wrapped_shift = *this;
+    wrapped_shift.wrapped = true;
+
+    return wrapped_shift;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename signal_T>
+typename sc_map_shift<range_T, object_T>::key_vector_type
+        sc_map_shift<range_T, object_T>::bind(
+        sc_map_base<range_type, signal_T>& signal_map) const
+{
+    SC_MAP_PROFILE(map->name(), "bind(shift)");
+
+    key_vector_type unmatched_keys;
+    key_type signal_key;
+
+    for (typename map_type::iterator port_it = map->begin();
+         port_it != map->end();
+         ++port_it)
+    {
+        const key_type& port_key = port_it.get_position();
+        signal_T* signal = NULL;
+        if (signal_map.range.shifted_key(port_key, offset, wrapped, signal_key))
+        {
+            signal = signal_map.objects.find(signal_map.range, signal_key);
+        }
+
+        if (signal != NULL)
+        {
+            port_it->bind(*signal);
+        }
+        else
+        {
+            unmatched_keys.push_back(port_key);
+        }
+    }
+
+    return unmatched_keys;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename signal_T>
+inline typename sc_map_shift<range_T, object_T>::key_vector_type
+        sc_map_shift<range_T, object_T>::operator()(
+        sc_map_base<range_type, signal_T>& signal_map) const
+{
+    return bind(signal_map);
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+inline const typename sc_map_shift<range_T, object_T>::key_type&
+        sc_map_shift<range_T, object_T>::get_offset() const
+{
+    return offset;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+inline bool sc_map_shift<range_T, object_T>::is_wrapped() const
+{
+    return wrapped;
+}
@@ -13,7 +13,7 @@
 
 #pragma once
 
-#include "sc_map_base.hpp"
+#include "sc_map_nd.hpp"
 #include <systemc.h>
 
 #include <string>
@@ -23,11 +23,20 @@
 
 //******************************************************************************
 
+/*!
+ * @brief Container for a regular structure with 2 dimensions.
+ *
+ * The keys of the container are the non-virtual sc_map_nd_key<2>. Keys of
+ * type sc_map_square_key convert implicitly to them and back, e.g. for at() or
+ * for the keys returned by get_key().
+ *
+ * @tparam object_T Type of the objects in the container.
+ */
 template <typename object_T>
-class sc_map_square : public sc_map_base<sc_map_square_range, object_T>
+class sc_map_square : public sc_map_nd<2, object_T>
 {
 public:
-    typedef sc_map_base<sc_map_square_range, object_T> base;
+    typedef sc_map_nd<2, object_T> base;
     typedef typename base::range_type range_type;
     typedef typename base::key_type key_type;
     typedef typename base::key_vector_type key_vector_type;
@@ -51,7 +60,15 @@ public:
 
     virtual ~sc_map_square() {};
 
-    object_T& at(const index_type& Y, const index_type& X);
+    /*!
+     * @brief Neighbors in a mesh, where north is Y-1 and west is X-1.
+     *
+     * Return NULL at the border of the container, unless wrap is set.
+     */
+    object_T* north(const key_type& key, const bool wrap = false);
+    object_T* south(const key_type& key, const bool wrap = false);
+    object_T* east(const key_type& key, const bool wrap = false);
+    object_T* west(const key_type& key, const bool wrap = false);
 
     const char* kind() const;
 };
@@ -62,15 +79,13 @@ public:
 template <typename object_T>
 sc_map_square<object_T>::sc_map_square(const size_type element_cnt_Y,
         const size_type element_cnt_X, const sc_module_name name) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(sc_map_square_key(),
             sc_map_square_key(element_cnt_Y-1, element_cnt_X-1));
 
     this->init(range, typename base::creator());
 
- //   simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -79,15 +94,13 @@ template <typename object_T>
 sc_map_square<object_T>::sc_map_square(const size_type element_cnt_Y,
         const size_type element_cnt_X, const sc_module_name name,
         const index_type start_id_Y, const index_type start_id_X) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(sc_map_square_key(start_id_Y, start_id_X),
             sc_map_square_key(start_id_Y+element_cnt_Y-1, start_id_X+element_cnt_X-1));
 
     this->init(range, typename base::creator());
 
- //   simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -97,15 +110,13 @@ template <typename config_type>
 sc_map_square<object_T>::sc_map_square(const size_type element_cnt_Y,
         const size_type element_cnt_X, const sc_module_name name,
         const config_type configuration) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(sc_map_square_key(),
             sc_map_square_key(element_cnt_Y-1, element_cnt_X-1));
 
     this->init(range, typename base::creator(), configuration);
 
-    //simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -116,15 +127,13 @@ sc_map_square<object_T>::sc_map_square(const size_type element_cnt_Y,
         const size_type element_cnt_X, const sc_module_name name,
         const config_type configuration, const index_type start_id_Y,
         const index_type start_id_X) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(sc_map_square_key(start_id_Y, start_id_X),
             sc_map_square_key(start_id_Y+element_cnt_Y-1, start_id_X+element_cnt_X-1));
 
     this->init(range, typename base::creator(), configuration);
 
- //   simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -132,13 +141,11 @@ sc_map_square<object_T>::sc_map_square(const size_type element_cnt_Y,
 template <typename object_T>
 sc_map_square<object_T>::sc_map_square(const key_type& start_key,
         const key_type& end_key, const sc_module_name name) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(start_key, end_key);
     this->init(range, typename base::creator());
 
-  //  simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -148,13 +155,11 @@ template <typename config_type>
 sc_map_square<object_T>::sc_map_square(const key_type& start_key,
         const key_type& end_key, const sc_module_name name,
         const config_type& configuration) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     range_type range = range_type(start_key, end_key);
     this->init(range, typename base::creator(), configuration);
 
-   // simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -162,12 +167,10 @@ sc_map_square<object_T>::sc_map_square(const key_type& start_key,
 template <typename object_T>
 sc_map_square<object_T>::sc_map_square(const range_type& new_range,
         const sc_module_name name) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     this->init(new_range, typename base::creator());
 
-  //  simulation_size.add_sc_map(kind());
-
     return;
 }
 
@@ -176,21 +179,43 @@ template <typename object_T>
 template <typename config_type>
 sc_map_square<object_T>::sc_map_square(const range_type& new_range,
         const sc_module_name name, const config_type& configuration) :
-        sc_map_base<range_type, object_T>(name)
+        base(name)
 {
     this->init(new_range, typename base::creator(), configuration);
 
-   // simulation_size.add_sc_map(kind());
-
     return;
 }
 
 //******************************************************************************
 template <typename object_T>
-object_T& sc_map_square<object_T>::at(const index_type& Y,
-        const index_type& X)
+inline object_T* sc_map_square<object_T>::north(const key_type& key,
+        const bool wrap)
+{
+    return this->neighbor(key, key_type(-1, 0), wrap);
+}
+
+//******************************************************************************
+template <typename object_T>
+inline object_T* sc_map_square<object_T>::south(const key_type& key,
+        const bool wrap)
+{
+    return this->neighbor(key, key_type(1, 0), wrap);
+}
+
+//******************************************************************************
+template <typename object_T>
+inline object_T* sc_map_square<object_T>::east(const key_type& key,
+        const bool wrap)
+{
+    return this->neighbor(key, key_type(0, 1), wrap);
+}
+
+//******************************************************************************
+template <typename object_T>
+inline object_T* sc_map_square<object_T>::west(const key_type& key,
+        const bool wrap)
 {
-    return base::at(key_type(Y, X));
+    return this->neighbor(key, key_type(0, -1), wrap);
 }
 
 //******************************************************************************
@@ -14,27 +14,132 @@
 #pragma once
 
 #include "sc_map_regular_key.hpp"
+#include "sc_map_packed_key.hpp"
 #include "sc_map_config.hpp"
 
 #include <string>
 #include <sstream>
+#include <functional>
 
 //******************************************************************************
 
+/*!
+ * @brief Key with the named indexes Y, X of a structure with 2 dimensions.
+ *
+ * The key is polymorphic and compared through the sc_map_key interface. The
+ * containers use the non-virtual sc_map_packed_key<2> instead. This key
+ * converts implicitly from and to it, so that it can be passed wherever a key
+ * of sc_map_square is expected and receive the keys of the container.
+ */
 class sc_map_square_key : public sc_map_regular_key
 {
 public:
     using sc_map_regular_key::index_type;
+    typedef sc_map_packed_key<2> packed_type;
+
+    class Comperator
+    {
+    public:
+        bool operator()(const sc_map_square_key& lhs, const sc_map_square_key& rhs) const
+        {
+            return lhs < rhs;
+        }
+    };
+
+    using sc_map_key::operator==;
+    using sc_map_key::operator!=;
+    using sc_map_key::operator<;
 
     index_type Y;
     index_type X;
 
     sc_map_square_key();
     sc_map_square_key(const index_type& Y, const index_type& X);
+    sc_map_square_key(const packed_type& packed_key);
     virtual ~sc_map_square_key() {};
 
     virtual std::string get_string() const;
+    virtual void append_string(std::string& buffer) const;
+    packed_type packed() const;
+
+    /*!
+     * @brief Converts the key to the key of sc_map_square, see packed().
+     */
+    operator packed_type() const;
+
+    index_type& operator[](const unsigned int dim);
+    const index_type& operator[](const unsigned int dim) const;
+    void set(const unsigned int dim, const index_type index);
 
     virtual bool operator==(const sc_map_key& other_key) const;
     virtual bool operator<(const sc_map_key& other_key) const;
+
+    bool operator==(const sc_map_square_key& other_key) const;
+    bool operator!=(const sc_map_square_key& other_key) const;
+    bool operator<(const sc_map_square_key& other_key) const;
 };
+
+//******************************************************************************
+namespace std
+{
+template <>
+struct hash<sc_map_square_key>
+{
+    size_t operator()(const sc_map_square_key& key) const
+    {
+        return hash<sc_map_square_key::packed_type>()(key.packed());
+    }
+};
+}
+
+//******************************************************************************
+
+//******************************************************************************
+inline sc_map_square_key::index_type& sc_map_square_key::operator[](const unsigned int dim)
+{
+    return (dim == 0) ? Y : X;
+}
+
+//******************************************************************************
+inline const sc_map_square_key::index_type& sc_map_square_key::operator[](const unsigned int dim) const
+{
+    return (dim == 0) ? Y : X;
+}
+
+//******************************************************************************
+inline void sc_map_square_key::set(const unsigned int dim, const index_type index)
+{
+    (*this)[dim] = index;
+
+    return;
+}
+
+//******************************************************************************
+inline bool sc_map_square_key::operator==(const sc_map_square_key& other_key) const
+{
+    return ((Y == other_key.Y) &&
+            (X == other_key.X));
+}
+
+//******************************************************************************
+inline bool sc_map_square_key::operator!=(const sc_map_square_key& other_key) const
+{
+    return !(*this == other_key);
+}
+
+//******************************************************************************
+inline bool sc_map_square_key::operator<(const sc_map_square_key& other_key) const
+{
+    if (Y != other_key.Y)
+    {
+        return Y < other_key.Y;
+    }
+
+    return X < other_key.X;
+}
+
+//******************************************************************************
+inline sc_map_square_key::operator packed_type() const
+{
+    return packed();
+}
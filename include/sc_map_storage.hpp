@@ -0,0 +1,534 @@
+/*!
+ * @file sc_map_storage.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Storage backends that map the keys of a container to its objects.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include <vector>
+#include <map>
+#include <new>
+#include <functional>
+#include <cstddef>
+
+//******************************************************************************
+
+/*!
+ * @brief Contiguous, uninitialized memory for the objects of a container.
+ *
+ * The memory for all objects is allocated at once. The objects are
+ * constructed in place by the creator of the container and have to be
+ * destroyed before the arena is released.
+ *
+ * @tparam object_T Type of the objects stored in the arena.
+ */
+template <typename object_T>
+class sc_map_arena
+{
+public:
+    typedef object_T object_type;
+
+    sc_map_arena();
+    ~sc_map_arena();
+
+    /*!
+     * @brief Allocates memory for a number of objects. Memory that was
+     *        allocated before is released.
+     *
+     * @param object_cnt Number of objects that fit into the arena.
+     */
+    void allocate(const std::size_t object_cnt);
+
+    /*!
+     * @brief Releases the memory of the arena.
+     */
+    void release();
+
+    /*!
+     * @brief Returns the memory of an object slot.
+     */
+    object_type* slot(const std::size_t index) const;
+
+    /*!
+     * @brief Calculates the slot of an object.
+     *
+     * @param object Pointer to the object.
+     * @param index Set to the slot of the object if it lies within the arena.
+     * @return true if the object lies within the arena.
+     */
+    bool slot_index(const object_type* object, std::size_t& index) const;
+
+private:
+    object_type* memory;
+    std::size_t memory_size;
+
+    sc_map_arena(const sc_map_arena&);
+    sc_map_arena& operator=(const sc_map_arena&);
+};
+
+//******************************************************************************
+
+/*!
+ * @brief Storage of the object pointers of an sc_map container.
+ *
+ * The storage backend is selected by the range type of the container. Ranges
+ * that span a dense box of keys (sc_map_regular_range) set dense_storage to
+ * true and are stored in a flat array indexed by the strided offset of the
+ * key. All other ranges are stored in a std::map ordered by the key.
+ *
+ * Both backends place the objects into one sc_map_arena, which is sized by
+ * init() from the range. The container requests the memory of an object with
+ * allocate(), constructs the object in place and registers it with insert().
+ * As the position of an object within the arena identifies its key, the key
+ * of an object is found in O(1) by find_key().
+ *
+ * @tparam range_T Range type of the container.
+ * @tparam object_T Type of the objects stored in the container.
+ * @tparam dense Selects the backend, taken from range_T::dense_storage.
+ */
+template <typename range_T, typename object_T,
+          bool dense = range_T::dense_storage>
+class sc_map_storage;
+
+//******************************************************************************
+
+/*!
+ * @brief Tree storage for ranges with arbitrary keys, e.g. sc_map_list_range.
+ *
+ * The objects are placed into the arena in the order they are allocated. The
+ * key of each slot is kept to resolve the key of an object.
+ */
+template <typename range_T, typename object_T>
+class sc_map_storage<range_T, object_T, false>
+{
+public:
+    typedef range_T range_type;
+    typedef typename range_type::key_type key_type;
+    typedef object_T object_type;
+    typedef std::map<key_type, object_type*, typename key_type::Comperator> map_type;
+    typedef typename map_type::const_iterator const_iterator;
+
+    sc_map_storage();
+
+    /*!
+     * @brief Removes all objects from the storage and allocates the arena.
+     *
+     * The objects of the storage must have been destroyed before.
+     *
+     * @param range Range of the container.
+     * @param object_cnt Number of objects that are added to the storage.
+     */
+    void init(const range_type& range, const std::size_t object_cnt);
+
+    /*!
+     * @brief Returns the uninitialized memory for the object of a key.
+     *
+     * @param range Range of the container.
+     * @param key Key of the object that will be constructed in the memory.
+     * @return Memory for the object or NULL if the arena is full.
+     */
+    void* allocate(const range_type& range, const key_type& key);
+
+    /*!
+     * @brief Adds an object that was constructed in allocated memory.
+     *
+     * @param range Range of the container.
+     * @param key Key under which the object is stored.
+     * @param object Pointer to the object.
+     */
+    void insert(const range_type& range, const key_type& key, object_type* object);
+
+    /*!
+     * @brief Removes all objects and releases the arena.
+     *
+     * The objects of the storage must have been destroyed before.
+     */
+    void release();
+
+    /*!
+     * @brief Returns the number of objects in the storage.
+     */
+    std::size_t size() const;
+
+    /*!
+     * @brief Looks up the object stored under a key.
+     *
+     * @param range Range of the container.
+     * @param key Key of the object.
+     * @return Pointer to the object or NULL if the key is not stored.
+     */
+    object_type* find(const range_type& range, const key_type& key) const;
+
+    /*!
+     * @brief Looks up the key under which an object is stored.
+     *
+     * @param range Range of the container.
+     * @param object Pointer to the object.
+     * @param key Set to the key of the object if it is found.
+     * @return true if the object is part of the storage.
+     */
+    bool find_key(const range_type& range, const object_type* object, key_type& key) const;
+
+    /*!
+     * @brief Estimates the memory used by the storage in addition to the
+     *        objects: tree nodes, slot keys and unused slots of the arena.
+     */
+    std::size_t overhead_bytes() const;
+
+    /*!
+     * @brief Iterate over the pairs of key and object pointer in the order of
+     *        the keys, which allows to walk two storages side by side.
+     */
+    const_iterator begin() const;
+    const_iterator end() const;
+
+private:
+    map_type objects;
+    sc_map_arena<object_type> arena;
+    std::size_t arena_size;
+    std::vector<key_type> slot_keys;
+};
+
+//******************************************************************************
+
+/*!
+ * @brief Dense storage for ranges that cover a box of keys.
+ *
+ * The objects are placed into the arena at the position that is calculated
+ * by the range with storage_offset(). This makes lookups O(1) and lets a
+ * traversal in key order run over consecutive memory. A flag per slot marks
+ * the slots whose object has been constructed, find() returns NULL for the
+ * others.
+ */
+template <typename range_T, typename object_T>
+class sc_map_storage<range_T, object_T, true>
+{
+public:
+    typedef range_T range_type;
+    typedef typename range_type::key_type key_type;
+    typedef object_T object_type;
+
+    sc_map_storage();
+
+    void init(const range_type& range, const std::size_t object_cnt);
+    void* allocate(const range_type& range, const key_type& key);
+    void insert(const range_type& range, const key_type& key, object_type* object);
+    void release();
+    std::size_t size() const;
+    object_type* find(const range_type& range, const key_type& key) const;
+    bool find_key(const range_type& range, const object_type* object, key_type& key) const;
+    std::size_t overhead_bytes() const;
+
+private:
+    sc_map_arena<object_type> arena;
+    std::size_t arena_size;
+    std::size_t object_cnt;
+    std::vector<bool> constructed;
+};
+
+//******************************************************************************
+
+//******************************************************************************
+template <typename object_T>
+sc_map_arena<object_T>::sc_map_arena() :
+        memory(NULL),
+        memory_size(0)
+{}
+
+//******************************************************************************
+template <typename object_T>
+sc_map_arena<object_T>::~sc_map_arena()
+{
+    release();
+
+    return;
+}
+
+//******************************************************************************
+template <typename object_T>
+void sc_map_arena<object_T>::allocate(const std::size_t object_cnt)
+{
+    release();
+
+    if (object_cnt != 0)
+    {
+        memory = static_cast<object_type*>(::operator new(object_cnt * sizeof(object_type)));
+        memory_size = object_cnt;
+    }
+
+    return;
+}
+
+//******************************************************************************
+template <typename object_T>
+void sc_map_arena<object_T>::release()
+{
+    ::operator delete(memory);
+    memory = NULL;
+    memory_size = 0;
+
+    return;
+}
+
+//******************************************************************************
+template <typename object_T>
+inline typename sc_map_arena<object_T>::object_type*
+        sc_map_arena<object_T>::slot(const std::size_t index) const
+{
+    return memory + index;
+}
+
+//******************************************************************************
+template <typename object_T>
+inline bool sc_map_arena<object_T>::slot_index(const object_type* object,
+        std::size_t& index) const
+{
+    std::less<const object_type*> less;
+    if (less(object, memory) || !less(object, memory + memory_size))
+    {
+        return false;
+    }
+
+    index = object - memory;
+
+    return true;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_storage<range_T, object_T, false>::sc_map_storage() :
+        arena_size(0)
+{}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_storage<range_T, object_T, false>::init(const range_type& range,
+        const std::size_t object_cnt)
+{
+    objects.clear();
+    slot_keys.clear();
+    slot_keys.reserve(object_cnt);
+    arena.allocate(object_cnt);
+    arena_size = object_cnt;
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void* sc_map_storage<range_T, object_T, false>::allocate(
+        const range_type& range, const key_type& key)
+{
+    if (slot_keys.size() >= arena_size)
+    {
+        return NULL;
+    }
+
+    void* memory = arena.slot(slot_keys.size());
+    slot_keys.push_back(key);
+
+    return memory;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_storage<range_T, object_T, false>::insert(const range_type& range,
+        const key_type& key, object_type* object)
+{
+    objects.insert(typename map_type::value_type(key, object));
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_storage<range_T, object_T, false>::release()
+{
+    objects.clear();
+    slot_keys.clear();
+    arena.release();
+    arena_size = 0;
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+std::size_t sc_map_storage<range_T, object_T, false>::size() const
+{
+    return objects.size();
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+typename sc_map_storage<range_T, object_T, false>::object_type*
+        sc_map_storage<range_T, object_T, false>::find(const range_type& range,
+        const key_type& key) const
+{
+    typename map_type::const_iterator object_it = objects.find(key);
+    if (object_it == objects.end())
+    {
+        return NULL;
+    }
+
+    return object_it->second;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+bool sc_map_storage<range_T, object_T, false>::find_key(const range_type& range,
+        const object_type* object, key_type& key) const
+{
+    std::size_t index;
+    if (!arena.slot_index(object, index) || (index >= slot_keys.size()))
+    {
+        return false;
+    }
+
+    key = slot_keys[index];
+
+    return true;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+std::size_t sc_map_storage<range_T, object_T, false>::overhead_bytes() const
+{
+    // a node of std::map holds the value, the color and three pointers
+    const std::size_t node_bytes = sizeof(typename map_type::value_type) + 4 * sizeof(void*);
+
+    return objects.size() * node_bytes + slot_keys.capacity() * sizeof(key_type)
+            + (arena_size - slot_keys.size()) * sizeof(object_type);
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+inline typename sc_map_storage<range_T, object_T, false>::const_iterator
+        sc_map_storage<range_T, object_T, false>::begin() const
+{
+    return objects.begin();
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+inline typename sc_map_storage<range_T, object_T, false>::const_iterator
+        sc_map_storage<range_T, object_T, false>::end() const
+{
+    return objects.end();
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_storage<range_T, object_T, true>::sc_map_storage() :
+        arena_size(0),
+        object_cnt(0)
+{}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_storage<range_T, object_T, true>::init(const range_type& range,
+        const std::size_t object_cnt)
+{
+    arena_size = range.storage_size();
+    arena.allocate(arena_size);
+    this->object_cnt = 0;
+    constructed.assign(arena_size, false);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void* sc_map_storage<range_T, object_T, true>::allocate(
+        const range_type& range, const key_type& key)
+{
+    std::size_t offset;
+    if (!range.storage_offset(key, offset) || (offset >= arena_size))
+    {
+        return NULL;
+    }
+
+    return arena.slot(offset);
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_storage<range_T, object_T, true>::insert(const range_type& range,
+        const key_type& key, object_type* object)
+{
+    std::size_t offset;
+    if (range.storage_offset(key, offset) && (offset < arena_size))
+    {
+        constructed[offset] = true;
+    }
+    ++object_cnt;
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_storage<range_T, object_T, true>::release()
+{
+    arena.release();
+    arena_size = 0;
+    object_cnt = 0;
+    constructed.clear();
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+std::size_t sc_map_storage<range_T, object_T, true>::size() const
+{
+    return object_cnt;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+inline typename sc_map_storage<range_T, object_T, true>::object_type*
+        sc_map_storage<range_T, object_T, true>::find(const range_type& range,
+        const key_type& key) const
+{
+    std::size_t offset;
+    if (!range.storage_offset(key, offset) || (offset >= arena_size)
+        || !constructed[offset])
+    {
+        return NULL;
+    }
+
+    return arena.slot(offset);
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+bool sc_map_storage<range_T, object_T, true>::find_key(const range_type& range,
+        const object_type* object, key_type& key) const
+{
+    std::size_t offset;
+    if (!arena.slot_index(object, offset))
+    {
+        return false;
+    }
+
+    key = range.storage_key(offset);
+
+    return true;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+std::size_t sc_map_storage<range_T, object_T, true>::overhead_bytes() const
+{
+    return (arena_size - object_cnt) * sizeof(object_type)
+            + constructed.capacity() / 8;
+}
@@ -0,0 +1,107 @@
+/*!
+ * @file sc_map_trace.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Registration of the objects of an sc_map container in a trace file.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_config.hpp"
+
+#include <systemc.h>
+
+#include <string>
+#include <cstddef>
+
+//******************************************************************************
+
+/*!
+ * @brief Key filter that accepts every key, used for complete traces.
+ */
+class sc_map_trace_all
+{
+public:
+    template <typename key_T>
+    bool operator()(const key_T& key) const;
+};
+
+//******************************************************************************
+
+/*!
+ * @brief Traces the objects from object_it up to end_it whose key is accepted
+ *        by key_filter, of which only every interval-th one is traced.
+ *
+ * The name of each traced object is name, sc_map::key_separator_char and its
+ * key, as for a complete trace of the container, so that the selected signals
+ * keep their names. The names are built in a single buffer, which keeps the
+ * prefix between the objects.
+ *
+ * @param tf Trace file in which the objects are registered.
+ * @param object_it Iterator to the first object considered.
+ * @param end_it End of the container, which object_it is compared to.
+ * @param name Name of the container in the trace.
+ * @param key_filter Function object that is called with the key of each
+ *        object and returns true if the object is to be traced.
+ * @param interval Only the first of each interval objects accepted by
+ *        key_filter is traced, 1 traces all of them. 0 is reported with
+ *        SC_REPORT_WARNING and no object is traced.
+ */
+template <typename iterator_T, typename end_iterator_T, typename key_filter_T>
+void sc_map_trace_objects(sc_trace_file* tf, iterator_T object_it,
+        const end_iterator_T& end_it, const std::string& name,
+        const key_filter_T& key_filter, const std::size_t interval);
+
+//******************************************************************************
+
+//******************************************************************************
+template <typename key_T>
+inline bool sc_map_trace_all::operator()(const key_T& key) const
+{
+    return true;
+}
+
+//******************************************************************************
+template <typename iterator_T, typename end_iterator_T, typename key_filter_T>
+void sc_map_trace_objects(sc_trace_file* tf, iterator_T object_it,
+        const end_iterator_T& end_it, const std::string& name,
+        const key_filter_T& key_filter, const std::size_t interval)
+{
+    if (interval == 0)
+    {
+        std::string message = name;
+        message += ": interval has to be at least 1, nothing is traced";
+        SC_REPORT_WARNING("sc_map_trace", message.c_str());
+        return;
+    }
+
+    std::string full_name = name;
+    full_name += sc_map::key_separator_char;
+    const std::string::size_type prefix_size = full_name.size();
+    std::size_t selected_cnt = 0;
+
+    for (; object_it != end_it; ++object_it)
+    {
+        if (!key_filter(object_it.get_position()))
+        {
+            continue;
+        }
+
+        if ((selected_cnt++ % interval) != 0)
+        {
+            continue;
+        }
+
+        full_name.resize(prefix_size);
+        object_it.get_position().append_string(full_name);
+        sc_trace(tf, *object_it, full_name);
+    }
+
+    return;
+}
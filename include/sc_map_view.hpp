@@ -0,0 +1,393 @@
+/*!
+ * @file sc_map_view.hpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ *
+ * @brief Non-owning view of a part of an sc_map container.
+ *
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#pragma once
+
+#include "sc_map_iterator.hpp"
+#include "sc_map_config.hpp"
+#include "sc_map_profiler.hpp"
+#include "sc_map_trace.hpp"
+
+#include <systemc.h>
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+template <typename range_T, typename object_T>
+class sc_map_base;
+
+//******************************************************************************
+
+/*!
+ * @brief View of the objects of a container that lie within a range.
+ *
+ * The view consists of a pointer to the container and a range by value. It
+ * does not own, copy or allocate any objects, so it can be passed by value,
+ * e.g. to a submodule that works on a part of the port map of its parent. For
+ * regular containers the range is a box of keys, for sc_map_list containers
+ * it is the subset of keys between two keys. Views can be nested, a view of a
+ * view is again a sc_map_view of the same container.
+ *
+ * The keys of a view are the keys of the container.
+ *
+ * @tparam range_T Range type of the container.
+ * @tparam object_T Type of the objects in the container.
+ */
+template <typename range_T, typename object_T>
+class sc_map_view
+{
+public:
+    typedef sc_map_base<range_T, object_T> map_type;
+    typedef range_T range_type;
+    typedef typename range_type::key_type key_type;
+    typedef object_T object_type;
+    typedef typename map_type::iterator iterator;
+    typedef std::size_t size_type;
+
+    /*!
+     * @brief Constructor: View of the whole container.
+     */
+    sc_map_view(map_type& sc_map);
+
+    /*!
+     * @brief Constructor: View of the objects between two keys.
+     */
+    sc_map_view(map_type& sc_map, const key_type& start_key, const key_type& end_key);
+
+    /*!
+     * @brief Constructor: View of the objects within a range.
+     */
+    sc_map_view(map_type& sc_map, const range_type& range);
+
+    iterator begin() const;
+    iterator end() const;
+
+    /*!
+     * @brief Returns the object of a key, the key must lie within the view.
+     *
+     * A key outside of the view is reported with SC_REPORT_ERROR.
+     */
+    object_type& at(const key_type& key) const;
+    object_type& operator[] (const key_type& key) const;
+
+    size_type size() const;
+    bool contains(const key_type& key) const;
+
+    /*!
+     * @brief Returns a view of the objects between two keys of this view.
+     */
+    sc_map_view operator()(const key_type& start_key, const key_type& end_key) const;
+
+    map_type& get_map() const;
+    const range_type& get_range() const;
+
+    template <typename signal_type>
+    void bind(sc_signal<signal_type>& signal) const;
+    template <typename signal_range_T, typename signal_T>
+    void bind(sc_map_base<signal_range_T, signal_T>& signal_map) const;
+    template <typename signal_range_T, typename signal_T>
+    void bind(const sc_map_view<signal_range_T, signal_T>& signal_view) const;
+    template <typename signal_map_T, typename signal_it_range_T>
+    void bind(sc_map_iterator<signal_map_T, signal_it_range_T> signal_it) const;
+
+    template<typename data_type>
+    void write(const data_type& value) const;
+    template<typename data_type>
+    void write_all(const std::vector<data_type>& values) const;
+    void write_bits(const sc_bv_base& bits) const;
+    template<typename data_type>
+    void read_all(std::vector<data_type>& values) const;
+    void read_bits(sc_bv_base& bits) const;
+
+private:
+    map_type* map;
+    range_type range;
+};
+
+//******************************************************************************
+template <typename trace_range_T, typename trace_object_T>
+void sc_trace(sc_trace_file* tf, const sc_map_view<trace_range_T, trace_object_T>& view, const std::string& name);
+
+//******************************************************************************
+/*!
+ * @brief Traces the objects of the view whose key is accepted by predicate,
+ *        a function object that is called with the key and returns bool.
+ */
+template <typename trace_range_T, typename trace_object_T, typename predicate_T>
+void sc_trace_if(sc_trace_file* tf, const sc_map_view<trace_range_T, trace_object_T>& view, const std::string& name, const predicate_T& predicate);
+
+//******************************************************************************
+/*!
+ * @brief Traces every interval-th object of the view, starting with the first
+ *        one.
+ */
+template <typename trace_range_T, typename trace_object_T>
+void sc_trace_sampled(sc_trace_file* tf, const sc_map_view<trace_range_T, trace_object_T>& view, const std::string& name, const std::size_t interval);
+
+//******************************************************************************
+template <typename signal_range_T, typename signal_T>
+sc_sensitive& operator<< (sc_sensitive& sensitivity_list, const sc_map_view<signal_range_T, signal_T>& signal_view);
+
+//******************************************************************************
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_view<range_T, object_T>::sc_map_view(map_type& sc_map) :
+        map(&sc_map),
+        range(*sc_map.get_range())
+{}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_view<range_T, object_T>::sc_map_view(map_type& sc_map,
+        const key_type& start_key, const key_type& end_key) :
+        map(&sc_map),
+        range(sc_map.get_range(), start_key, end_key)
+{}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_view<range_T, object_T>::sc_map_view(map_type& sc_map,
+        const range_type& range) :
+        map(&sc_map),
+        range(range)
+{}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+inline typename sc_map_view<range_T, object_T>::iterator
+        sc_map_view<range_T, object_T>::begin() const
+{
+    return iterator(map, range);
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+inline typename sc_map_view<range_T, object_T>::iterator
+        sc_map_view<range_T, object_T>::end() const
+{
+    return iterator(map, iterator::end);
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+inline typename sc_map_view<range_T, object_T>::object_type&
+        sc_map_view<range_T, object_T>::at(const key_type& key) const
+{
+    if (!range.key_in_range(key))
+    {
+        std::string message = "key ";
+        key.append_string(message);
+        message += " is outside of the view";
+        SC_REPORT_ERROR("sc_map_view", message.c_str());
+    }
+
+    return map->at(key);
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+inline typename sc_map_view<range_T, object_T>::object_type&
+        sc_map_view<range_T, object_T>::operator[] (const key_type& key) const
+{
+    return at(key);
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+typename sc_map_view<range_T, object_T>::size_type
+        sc_map_view<range_T, object_T>::size() const
+{
+    return range.size();
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+bool sc_map_view<range_T, object_T>::contains(const key_type& key) const
+{
+    return range.key_in_range(key);
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+sc_map_view<range_T, object_T> sc_map_view<range_T, object_T>::operator()(
+        const key_type& start_key, const key_type& end_key) const
+{
+    return sc_map_view(*map, range_type(&range, start_key, end_key));
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+typename sc_map_view<range_T, object_T>::map_type&
+        sc_map_view<range_T, object_T>::get_map() const
+{
+    return *map;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+const typename sc_map_view<range_T, object_T>::range_type&
+        sc_map_view<range_T, object_T>::get_range() const
+{
+    return range;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename signal_type>
+void sc_map_view<range_T, object_T>::bind(sc_signal<signal_type>& signal) const
+{
+    begin().bind(signal);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename signal_range_T, typename signal_T>
+void sc_map_view<range_T, object_T>::bind(
+        sc_map_base<signal_range_T, signal_T>& signal_map) const
+{
+    begin().bind(signal_map.begin());
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename signal_range_T, typename signal_T>
+void sc_map_view<range_T, object_T>::bind(
+        const sc_map_view<signal_range_T, signal_T>& signal_view) const
+{
+    begin().bind(signal_view.begin());
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename signal_map_T, typename signal_it_range_T>
+void sc_map_view<range_T, object_T>::bind(
+        sc_map_iterator<signal_map_T, signal_it_range_T> signal_it) const
+{
+    begin().bind(signal_it);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename data_type>
+void sc_map_view<range_T, object_T>::write(const data_type& value) const
+{
+    begin().write(value);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename data_type>
+void sc_map_view<range_T, object_T>::write_all(
+        const std::vector<data_type>& values) const
+{
+    begin().write_all(values);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_view<range_T, object_T>::write_bits(const sc_bv_base& bits) const
+{
+    begin().write_bits(bits);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+template <typename data_type>
+void sc_map_view<range_T, object_T>::read_all(
+        std::vector<data_type>& values) const
+{
+    begin().read_all(values);
+
+    return;
+}
+
+//******************************************************************************
+template <typename range_T, typename object_T>
+void sc_map_view<range_T, object_T>::read_bits(sc_bv_base& bits) const
+{
+    begin().read_bits(bits);
+
+    return;
+}
+
+//******************************************************************************
+template <typename trace_range_T, typename trace_object_T>
+void sc_trace(sc_trace_file* tf,
+        const sc_map_view<trace_range_T, trace_object_T>& view,
+        const std::string& name)
+{
+    SC_MAP_PROFILE(view.get_map().name(), "sc_trace");
+
+    sc_map_trace_objects(tf, view.begin(), view.end(), name, sc_map_trace_all(), 1);
+
+    return;
+}
+
+//******************************************************************************
+template <typename trace_range_T, typename trace_object_T, typename predicate_T>
+void sc_trace_if(sc_trace_file* tf,
+        const sc_map_view<trace_range_T, trace_object_T>& view,
+        const std::string& name, const predicate_T& predicate)
+{
+    SC_MAP_PROFILE(view.get_map().name(), "sc_trace_if");
+
+    sc_map_trace_objects(tf, view.begin(), view.end(), name, predicate, 1);
+
+    return;
+}
+
+//******************************************************************************
+template <typename trace_range_T, typename trace_object_T>
+void sc_trace_sampled(sc_trace_file* tf,
+        const sc_map_view<trace_range_T, trace_object_T>& view,
+        const std::string& name, const std::size_t interval)
+{
+    SC_MAP_PROFILE(view.get_map().name(), "sc_trace_sampled");
+
+    sc_map_trace_objects(tf, view.begin(), view.end(), name, sc_map_trace_all(), interval);
+
+    return;
+}
+
+//******************************************************************************
+template <typename signal_range_T, typename signal_T>
+sc_sensitive& operator<< (sc_sensitive& sensitivity_list,
+        const sc_map_view<signal_range_T, signal_T>& signal_view)
+{
+    SC_MAP_PROFILE(signal_view.get_map().name(), "sensitive <<");
+
+    for (typename sc_map_view<signal_range_T, signal_T>::iterator signal_it = signal_view.begin();
+         signal_it != signal_view.end();
+         ++signal_it)
+    {
+        sensitivity_list << *signal_it;
+    }
+
+    return sensitivity_list;
+}
@@ -3,7 +3,10 @@
  * @author Christian Amstutz
  * @date April 15, 2016
  *
- * @brief
+ * @brief Memory accounting of the sc_map containers of a model.
+ *
+ * The accounting is opt-in: the containers only report to simulation_size if
+ * the library and the model are compiled with SC_MAP_SIZE_ANALYZER defined.
  *
  */
 
@@ -11,94 +14,106 @@
  *  Copyright (c) 2016 by Christian Amstutz
  */
 
-#include <map>
-#include <string>
-#include <sstream>
-#include <iomanip>
+#pragma once
 
 #include <systemc.h>
 
-#pragma once
+#include <map>
+#include <vector>
+#include <string>
+#include <ostream>
+#include <cstddef>
+
+//******************************************************************************
 
+/*!
+ * @brief Collects the number of elements and the memory of each sc_map.
+ *
+ * For each container the following is recorded:
+ * - element_bytes: size of the element objects themselves, without memory
+ *   the objects allocate on their own, e.g. for their names.
+ * - storage_bytes: overhead of the storage, i.e. tree nodes, the keys kept
+ *   for get_key() and unused slots of the arena.
+ * - range_bytes: size of the range of the container including the keys it
+ *   allocated, e.g. the key list of sc_map_list.
+ * - iterator_cnt and iterator_bytes: number of iterators created for the
+ *   container and the heap memory of the sub-ranges built for them.
+ *
+ * The report is available as text, JSON and CSV. The containers are sorted
+ * by their total size, so the containers that dominate the memory of a model
+ * are listed first.
+ */
 class size_analyzer
 {
-    std::map<std::string, unsigned int> sc_map_counter;
-    unsigned int total_sc_map  = 0;
+public:
+    struct map_record
+    {
+        std::string name;
+        std::string kind;
+        std::string element_kind;
+        std::size_t element_cnt;
+        std::size_t element_bytes;
+        std::size_t storage_bytes;
+        std::size_t range_bytes;
+        std::size_t iterator_cnt;
+        std::size_t iterator_bytes;
+
+        map_record();
+        std::size_t total_bytes() const;
+    };
+
+    typedef std::vector<map_record> record_vector_type;
+
+    size_analyzer();
+
+    /*!
+     * @brief Records a container after its objects have been created. A
+     *        container that is initialized again replaces its record.
+     */
+    void add_sc_map(const void* sc_map, const map_record& record);
+    void remove_sc_map(const void* sc_map);
+    void add_iterator(const void* sc_map, const std::size_t heap_bytes);
+
+    /*!
+     * @brief Returns the kind of an element, empty if it is not an sc_object.
+     */
+    static const char* kind_of(const sc_object* element);
+    static const char* kind_of(const void* element);
+
+    record_vector_type get_records() const;
+    map_record get_total() const;
+
+    std::string get_result() const;
+    void print_report() const;
+    void write_json(std::ostream& output) const;
+    void write_csv(std::ostream& output) const;
+
+    /*!
+     * @brief Writes the report to a file, as CSV if the file name ends with
+     *        ".csv", otherwise as JSON.
+     */
+    bool write_report(const std::string& file_name) const;
+
+private:
+    std::map<const void*, map_record> records;
+};
 
-    std::map<std::string, unsigned int> element_counter;
-    unsigned int total_elements = 0;
+//******************************************************************************
 
+/*!
+ * @brief Module that writes the report of simulation_size at the end of
+ *        elaboration, e.g. size_analyzer_report report("sizes", "sizes.json");
+ */
+class size_analyzer_report : public sc_module
+{
 public:
-    void add_element(sc_object* systemc_element)
-    {
-        std::string element_kind = systemc_element->kind();
-        std::map<std::string, unsigned int>::iterator specific_counter = element_counter.find(element_kind);
-        if ( specific_counter != element_counter.end() )
-        {
-            (specific_counter->second)++;
-        }
-        else
-        {
-            element_counter[element_kind] = 1;
-        }
-
-        ++total_elements;
-
-        return;
-    }
-
-    void add_sc_map()
-    {
-        ++total_sc_map;
-    }
+    size_analyzer_report(sc_module_name _name, const std::string& file_name);
 
-    void add_sc_map(const char* kind)
-    {
-        std::map<std::string, unsigned int>::iterator specific_counter = sc_map_counter.find(kind);
-        if ( specific_counter != sc_map_counter.end() )
-        {
-            (specific_counter->second)++;
-        }
-        else
-        {
-            sc_map_counter[kind] = 1;
-        }
-
-        return;
-    }
-
-    std::string get_result()
-    {
-        std::stringstream output_string;
-
-        output_string << "***************************************" << std::endl;
-        output_string << total_sc_map << " sc_map objects by " << std::endl;
-        for(std::map<std::string, unsigned int>::iterator one_cnt = sc_map_counter.begin();
-            one_cnt != sc_map_counter.end();
-            ++one_cnt)
-        {
-            output_string << "  " <<  std::setw(12) << one_cnt->first << ": " << one_cnt->second << std::endl;
-        }
-
-        output_string << "***************************************" << std::endl;
-        output_string << total_elements << " elements within sc_map containers" << std::endl;
-        for(std::map<std::string, unsigned int>::iterator one_cnt = element_counter.begin();
-            one_cnt != element_counter.end();
-            ++one_cnt)
-        {
-            output_string << "  " <<  std::setw(12) << one_cnt->first << ": " << one_cnt->second << std::endl;
-        }
-        output_string << "***************************************" << std::endl;
-
-        return output_string.str();
-    }
-
-    void print_report()
-    {
-        std::cout << get_result();
+    virtual void end_of_elaboration();
 
-        return;
-    }
+private:
+    std::string file_name;
 };
 
-//extern size_analyzer simulation_size;
+//******************************************************************************
+extern size_analyzer simulation_size;
@@ -28,60 +28,48 @@ sc_map_cube_key::sc_map_cube_key(const index_type& Z, const index_type& Y,
         X(X)
 {}
 
+//******************************************************************************
+sc_map_cube_key::sc_map_cube_key(const packed_type& packed_key) :
+        Z(packed_key.get(0)),
+        Y(packed_key.get(1)),
+        X(packed_key.get(2))
+{}
+
 //******************************************************************************
 std::string sc_map_cube_key::get_string() const
 {
-    std::stringstream collection_stream;
-    collection_stream << Z;
-    collection_stream << sc_map::key_sub_separator_char;
-    collection_stream << Y;
-    collection_stream << sc_map::key_sub_separator_char;
-    collection_stream << X;
+    std::string key_string;
+    append_string(key_string);
 
-    return collection_stream.str();
+    return key_string;
 }
 
 //******************************************************************************
-bool sc_map_cube_key::operator==(const sc_map_key& other_key) const
+void sc_map_cube_key::append_string(std::string& buffer) const
 {
-    const sc_map_cube_key* other_key_cube =
-            dynamic_cast<const sc_map_cube_key*>(&other_key);
+    append_index(buffer, Z);
+    buffer += sc_map::key_sub_separator_char;
+    append_index(buffer, Y);
+    buffer += sc_map::key_sub_separator_char;
+    append_index(buffer, X);
 
-    bool equal = true;
+    return;
+}
 
-    equal &= this->Z == other_key_cube->Z;
-    equal &= this->Y == other_key_cube->Y;
-    equal &= this->X == other_key_cube->X;
+//******************************************************************************
+sc_map_cube_key::packed_type sc_map_cube_key::packed() const
+{
+    return packed_type(Z, Y, X);
+}
 
-    return equal;
+//******************************************************************************
+bool sc_map_cube_key::operator==(const sc_map_key& other_key) const
+{
+    return (*this == dynamic_cast<const sc_map_cube_key&>(other_key));
 }
 
 //******************************************************************************
 bool sc_map_cube_key::operator<(const sc_map_key& other_key) const
 {
-    const sc_map_cube_key* other_key_cube =
-            dynamic_cast<const sc_map_cube_key*>(&other_key);
-
-    bool smaller = false;
-
-    if (this->Z < other_key_cube->Z)
-    {
-        smaller = true;
-    }
-    else if (this->Z == other_key_cube->Z)
-    {
-        if (this->Y < other_key_cube->Y)
-        {
-            smaller = true;
-        }
-        else if (this->Y == other_key_cube->Y)
-        {
-            if (this->X < other_key_cube->X)
-            {
-                smaller = true;
-            }
-        }
-    }
-
-    return smaller;
+    return (*this < dynamic_cast<const sc_map_cube_key&>(other_key));
 }
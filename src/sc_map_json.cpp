@@ -0,0 +1,40 @@
+/*!
+ * @file sc_map_json.cpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#include "../include/sc_map_json.hpp"
+
+#include <iomanip>
+
+//******************************************************************************
+void sc_map_write_json_string(std::ostream& output, const std::string& text)
+{
+    output << '"';
+    for (std::string::const_iterator char_it = text.begin();
+         char_it != text.end();
+         ++char_it)
+    {
+        if ((*char_it == '"') || (*char_it == '\\'))
+        {
+            output << '\\' << *char_it;
+        }
+        else if (static_cast<unsigned char>(*char_it) < 0x20)
+        {
+            output << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                   << static_cast<int>(*char_it) << std::dec << std::setfill(' ');
+        }
+        else
+        {
+            output << *char_it;
+        }
+    }
+    output << '"';
+
+    return;
+}
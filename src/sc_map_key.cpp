@@ -17,6 +17,14 @@ bool sc_map_key::Comperator::operator()(const sc_map_key& lhs,
     return (lhs < rhs);
 }
 
+//******************************************************************************
+void sc_map_key::append_string(std::string& buffer) const
+{
+    buffer += get_string();
+
+    return;
+}
+
 //******************************************************************************
 bool sc_map_key::operator!=(const sc_map_key& other_key) const
 {
@@ -18,33 +18,42 @@ sc_map_linear_key::sc_map_linear_key(index_type X) :
         X(X)
 {}
 
+//******************************************************************************
+sc_map_linear_key::sc_map_linear_key(const packed_type& packed_key) :
+        X(packed_key.get(0))
+{}
+
 //******************************************************************************
 std::string sc_map_linear_key::get_string() const
 {
-    std::stringstream collection_stream;
-    collection_stream << X;
+    std::string key_string;
+    append_string(key_string);
 
-    return collection_stream.str();
+    return key_string;
 }
 
 //******************************************************************************
-bool sc_map_linear_key::operator==(const sc_map_key& other_key) const
+void sc_map_linear_key::append_string(std::string& buffer) const
 {
-    const sc_map_linear_key* other_key_linear =
-            dynamic_cast<const sc_map_linear_key*>(&other_key);
+    append_index(buffer, X);
 
-    // todo: check for successful casting
-
-    return (this->X == other_key_linear->X);
+    return;
 }
 
 //******************************************************************************
-bool sc_map_linear_key::operator<(const sc_map_key& other_key) const
+sc_map_linear_key::packed_type sc_map_linear_key::packed() const
 {
-    const sc_map_linear_key* other_key_linear =
-            dynamic_cast<const sc_map_linear_key*>(&other_key);
+    return packed_type(X);
+}
 
-    // todo: check for successful casting
+//******************************************************************************
+bool sc_map_linear_key::operator==(const sc_map_key& other_key) const
+{
+    return (*this == dynamic_cast<const sc_map_linear_key&>(other_key));
+}
 
-    return (this->X < other_key_linear->X);
+//******************************************************************************
+bool sc_map_linear_key::operator<(const sc_map_key& other_key) const
+{
+    return (*this < dynamic_cast<const sc_map_linear_key&>(other_key));
 }
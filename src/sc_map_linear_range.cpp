@@ -10,11 +10,19 @@
 
 #include "../include/sc_map_linear_range.hpp"
 
+#include <systemc.h>
+
+#include <string>
+
 //******************************************************************************
 sc_map_linear_range::sc_map_linear_range() :
         sc_map_regular_range(sc_map_linear_key(0), sc_map_linear_key(0)),
         X_dir(UP)
-{}
+{
+    init(start_key, end_key);
+
+    return;
+}
     // todo:: this is basically not correct!
 
 //******************************************************************************
@@ -33,6 +41,17 @@ sc_map_linear_range::sc_map_linear_range(
         const key_type& start_key, const key_type& end_key) :
         sc_map_regular_range(start_key, end_key)
 {
+    if ((base_range != NULL) &&
+        (!base_range->key_in_range(start_key) || !base_range->key_in_range(end_key)))
+    {
+        std::string message = "sub-range ";
+        start_key.append_string(message);
+        message += " to ";
+        end_key.append_string(message);
+        message += " is outside of the base range";
+        SC_REPORT_ERROR("sc_map_linear_range", message.c_str());
+    }
+
     init(start_key, end_key);
 
     return;
@@ -50,6 +69,17 @@ void sc_map_linear_range::init(const key_type& start_key, const key_type& end_ke
         X_dir = DOWN;
     }
 
+    if (X_dir == UP)
+    {
+        X_low = start_key.X;
+        X_size = end_key.X - start_key.X + 1;
+    }
+    else
+    {
+        X_low = end_key.X;
+        X_size = start_key.X - end_key.X + 1;
+    }
+
     return;
 }
 
@@ -62,11 +92,9 @@ sc_map_linear_range* sc_map_linear_range::clone() const
 //******************************************************************************
 bool sc_map_linear_range::next_key(key_type& key) const
 {
-    sc_map_linear_key* key_linear = dynamic_cast<sc_map_linear_key*>(&key);
+    key_type* key_linear = &key;
     sc_map_linear_key new_key;
 
-    // todo: check for correct casting
-
     if (*key_linear == end_key)
     {
         return false;
@@ -85,3 +113,143 @@ bool sc_map_linear_range::next_key(key_type& key) const
 
     return true;
 }
+
+//******************************************************************************
+std::size_t sc_map_linear_range::size() const
+{
+    return X_size;
+}
+
+//******************************************************************************
+bool sc_map_linear_range::key_in_range(const key_type& key) const
+{
+    std::size_t index;
+
+    return index_of(key, index);
+}
+
+//******************************************************************************
+bool sc_map_linear_range::index_of(const key_type& key,
+        std::size_t& index) const
+{
+    std::size_t X_index;
+    if (X_dir == UP)
+    {
+        X_index = key.X - start_key.X;
+    }
+    else
+    {
+        X_index = start_key.X - key.X;
+    }
+
+    if (X_index >= X_size)
+    {
+        return false;
+    }
+
+    index = X_index;
+
+    return true;
+}
+
+//******************************************************************************
+sc_map_linear_range::key_type sc_map_linear_range::key_at(
+        const std::size_t index) const
+{
+    if (X_dir == UP)
+    {
+        return key_type(start_key.X + static_cast<index_type>(index));
+    }
+
+    return key_type(start_key.X - static_cast<index_type>(index));
+}
+
+//******************************************************************************
+std::size_t sc_map_linear_range::storage_size() const
+{
+    return X_size;
+}
+
+//******************************************************************************
+bool sc_map_linear_range::storage_offset(const key_type& key,
+        std::size_t& offset) const
+{
+    std::size_t X_offset = key.X - X_low;
+
+    if (X_offset >= X_size)
+    {
+        return false;
+    }
+
+    offset = X_offset;
+
+    return true;
+}
+
+//******************************************************************************
+sc_map_linear_range::key_type sc_map_linear_range::storage_key(
+        const std::size_t offset) const
+{
+    return key_type(X_low + static_cast<index_type>(offset));
+}
+
+//******************************************************************************
+bool sc_map_linear_range::intersection(const sc_map_linear_range& other,
+        sc_map_linear_range& result) const
+{
+    const index_type X_high = X_low + static_cast<index_type>(X_size) - 1;
+    const index_type other_high = other.X_low + static_cast<index_type>(other.X_size) - 1;
+
+    const index_type part_low = (X_low > other.X_low) ? X_low : other.X_low;
+    const index_type part_high = (X_high < other_high) ? X_high : other_high;
+    if (part_low > part_high)
+    {
+        return false;
+    }
+
+    result = part(part_low, part_high);
+
+    return true;
+}
+
+//******************************************************************************
+sc_map_linear_range::range_vector_type sc_map_linear_range::difference(
+        const sc_map_linear_range& other) const
+{
+    range_vector_type parts;
+
+    sc_map_linear_range overlap;
+    if (!intersection(other, overlap))
+    {
+        parts.push_back(*this);
+        return parts;
+    }
+
+    const index_type X_high = X_low + static_cast<index_type>(X_size) - 1;
+    const index_type overlap_high = overlap.X_low + static_cast<index_type>(overlap.X_size) - 1;
+
+    if (X_low < overlap.X_low)
+    {
+        parts.push_back(part(X_low, overlap.X_low - 1));
+    }
+    if (overlap_high < X_high)
+    {
+        parts.push_back(part(overlap_high + 1, X_high));
+    }
+
+    return parts;
+}
+
+//******************************************************************************
+sc_map_linear_range sc_map_linear_range::part(const index_type part_low,
+        const index_type part_high) const
+{
+    if (X_dir == UP)
+    {
+        return sc_map_linear_range(key_type(part_low), key_type(part_high));
+    }
+    else
+    {
+        return sc_map_linear_range(key_type(part_high), key_type(part_low));
+    }
+}
@@ -0,0 +1,404 @@
+/*!
+ * @file sc_map_packed_bool.cpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#include "../include/sc_map_packed_bool.hpp"
+
+const bool sc_map_bool_bank::bit_values[2] = {false, true};
+
+//******************************************************************************
+sc_map_bool_bank::sc_map_bool_bank(const char* name) :
+        sc_prim_channel(name),
+        bit_cnt(0),
+        change_delta(~static_cast<sc_dt::uint64>(0))
+{}
+
+//******************************************************************************
+sc_map_bool_bank::~sc_map_bool_bank()
+{
+    release_events();
+
+    return;
+}
+
+//******************************************************************************
+void sc_map_bool_bank::resize(const std::size_t bit_cnt)
+{
+    const std::size_t word_cnt = (bit_cnt + SC_DIGIT_SIZE - 1) / SC_DIGIT_SIZE;
+
+    release_events();
+
+    this->bit_cnt = bit_cnt;
+    current_words.assign(word_cnt, 0);
+    new_words.assign(word_cnt, 0);
+    changed_words.assign(word_cnt, 0);
+    dirty_flags.assign(word_cnt, false);
+    dirty_words.clear();
+    changed_word_ids.clear();
+    traced_values.clear();
+
+    return;
+}
+
+//******************************************************************************
+std::size_t sc_map_bool_bank::size() const
+{
+    return bit_cnt;
+}
+
+//******************************************************************************
+std::size_t sc_map_bool_bank::word_count() const
+{
+    return current_words.size();
+}
+
+//******************************************************************************
+const bool& sc_map_bool_bank::read(const std::size_t bit) const
+{
+    const word_type word = current_words[bit / SC_DIGIT_SIZE];
+
+    return bit_values[(word >> (bit % SC_DIGIT_SIZE)) & 1];
+}
+
+//******************************************************************************
+void sc_map_bool_bank::write(const std::size_t bit, const bool value)
+{
+    const std::size_t word_id = bit / SC_DIGIT_SIZE;
+    const word_type bit_mask = static_cast<word_type>(1) << (bit % SC_DIGIT_SIZE);
+
+    write_word(word_id, value ? bit_mask : 0, bit_mask);
+
+    return;
+}
+
+//******************************************************************************
+const bool& sc_map_bool_bank::trace_value(const std::size_t bit)
+{
+    if (traced_values.empty())
+    {
+        traced_values.resize(bit_cnt);
+        for (std::size_t value_bit = 0; value_bit < bit_cnt; ++value_bit)
+        {
+            traced_values[value_bit].value = read(value_bit);
+        }
+    }
+
+    return traced_values[bit].value;
+}
+
+//******************************************************************************
+sc_map_bool_bank::word_type sc_map_bool_bank::read_word(
+        const std::size_t word_id) const
+{
+    return current_words[word_id];
+}
+
+//******************************************************************************
+void sc_map_bool_bank::write_word(const std::size_t word_id,
+        const word_type value, const word_type mask)
+{
+    word_type new_word = (new_words[word_id] & ~mask) | (value & mask);
+    if (new_word == new_words[word_id])
+    {
+        return;
+    }
+
+    new_words[word_id] = new_word;
+    mark_dirty(word_id);
+
+    return;
+}
+
+//******************************************************************************
+void sc_map_bool_bank::write_bits(const sc_bv_base& bits)
+{
+    std::size_t write_cnt = static_cast<std::size_t>(bits.length());
+    if (write_cnt > bit_cnt)
+    {
+        write_cnt = bit_cnt;
+    }
+
+    for (std::size_t word_id = 0; word_id * SC_DIGIT_SIZE < write_cnt; ++word_id)
+    {
+        std::size_t word_bits = write_cnt - word_id * SC_DIGIT_SIZE;
+        word_type mask = ~static_cast<word_type>(0);
+        if (word_bits < SC_DIGIT_SIZE)
+        {
+            mask = (static_cast<word_type>(1) << word_bits) - 1;
+        }
+
+        write_word(word_id, bits.get_word(word_id), mask);
+    }
+
+    return;
+}
+
+//******************************************************************************
+void sc_map_bool_bank::read_bits(sc_bv_base& bits) const
+{
+    const std::size_t read_cnt = static_cast<std::size_t>(bits.length());
+
+    for (std::size_t word_id = 0; word_id * SC_DIGIT_SIZE < read_cnt; ++word_id)
+    {
+        word_type word = 0;
+        if (word_id < current_words.size())
+        {
+            word = current_words[word_id];
+        }
+
+        std::size_t word_bits = read_cnt - word_id * SC_DIGIT_SIZE;
+        if (word_bits < SC_DIGIT_SIZE)
+        {
+            word &= (static_cast<word_type>(1) << word_bits) - 1;
+        }
+
+        bits.set_word(word_id, word);
+    }
+
+    return;
+}
+
+//******************************************************************************
+bool sc_map_bool_bank::event(const std::size_t bit) const
+{
+    if (change_delta != sc_delta_count())
+    {
+        return false;
+    }
+
+    return (changed_words[bit / SC_DIGIT_SIZE] >> (bit % SC_DIGIT_SIZE)) & 1;
+}
+
+//******************************************************************************
+const sc_event& sc_map_bool_bank::value_changed_event(const std::size_t bit)
+{
+    return get_events(bit).value_changed;
+}
+
+//******************************************************************************
+const sc_event& sc_map_bool_bank::posedge_event(const std::size_t bit)
+{
+    return get_events(bit).posedge;
+}
+
+//******************************************************************************
+const sc_event& sc_map_bool_bank::negedge_event(const std::size_t bit)
+{
+    return get_events(bit).negedge;
+}
+
+//******************************************************************************
+void sc_map_bool_bank::update()
+{
+    for (std::vector<std::size_t>::const_iterator word_it = changed_word_ids.begin();
+         word_it != changed_word_ids.end();
+         ++word_it)
+    {
+        changed_words[*word_it] = 0;
+    }
+    changed_word_ids.clear();
+
+    for (std::vector<std::size_t>::const_iterator word_it = dirty_words.begin();
+         word_it != dirty_words.end();
+         ++word_it)
+    {
+        const std::size_t word_id = *word_it;
+        dirty_flags[word_id] = false;
+
+        word_type changed = current_words[word_id] ^ new_words[word_id];
+        if (changed == 0)
+        {
+            continue;
+        }
+
+        current_words[word_id] = new_words[word_id];
+        changed_words[word_id] = changed;
+        changed_word_ids.push_back(word_id);
+
+        for (std::size_t word_bit = 0; changed != 0; ++word_bit, changed >>= 1)
+        {
+            if ((changed & 1) == 0)
+            {
+                continue;
+            }
+
+            const std::size_t bit = word_id * SC_DIGIT_SIZE + word_bit;
+            const bool value = (new_words[word_id] >> word_bit) & 1;
+            if (!traced_values.empty())
+            {
+                traced_values[bit].value = value;
+            }
+
+            if (!events.empty() && (events[bit] != NULL))
+            {
+                events[bit]->value_changed.notify(SC_ZERO_TIME);
+                if (value)
+                {
+                    events[bit]->posedge.notify(SC_ZERO_TIME);
+                }
+                else
+                {
+                    events[bit]->negedge.notify(SC_ZERO_TIME);
+                }
+            }
+        }
+    }
+    dirty_words.clear();
+
+    change_delta = sc_delta_count();
+
+    return;
+}
+
+//******************************************************************************
+void sc_map_bool_bank::mark_dirty(const std::size_t word_id)
+{
+    if (dirty_flags[word_id])
+    {
+        return;
+    }
+
+    if (dirty_words.empty())
+    {
+        request_update();
+    }
+    dirty_flags[word_id] = true;
+    dirty_words.push_back(word_id);
+
+    return;
+}
+
+//******************************************************************************
+sc_map_bool_bank::bit_events& sc_map_bool_bank::get_events(
+        const std::size_t bit)
+{
+    if (events.empty())
+    {
+        events.assign(bit_cnt, NULL);
+    }
+
+    if (events[bit] == NULL)
+    {
+        events[bit] = new bit_events;
+    }
+
+    return *events[bit];
+}
+
+//******************************************************************************
+void sc_map_bool_bank::release_events()
+{
+    for (std::vector<bit_events*>::iterator event_it = events.begin();
+         event_it != events.end();
+         ++event_it)
+    {
+        delete *event_it;
+    }
+    events.clear();
+
+    return;
+}
+
+//******************************************************************************
+sc_map_bool_proxy::sc_map_bool_proxy(sc_map_bool_bank& bank,
+        const std::size_t bit) :
+        bank(&bank),
+        bit(bit)
+{}
+
+//******************************************************************************
+const sc_event& sc_map_bool_proxy::default_event() const
+{
+    return bank->value_changed_event(bit);
+}
+
+//******************************************************************************
+const sc_event& sc_map_bool_proxy::value_changed_event() const
+{
+    return bank->value_changed_event(bit);
+}
+
+//******************************************************************************
+const sc_event& sc_map_bool_proxy::posedge_event() const
+{
+    return bank->posedge_event(bit);
+}
+
+//******************************************************************************
+const sc_event& sc_map_bool_proxy::negedge_event() const
+{
+    return bank->negedge_event(bit);
+}
+
+//******************************************************************************
+const bool& sc_map_bool_proxy::read() const
+{
+    return bank->read(bit);
+}
+
+//******************************************************************************
+const bool& sc_map_bool_proxy::get_data_ref() const
+{
+    return bank->trace_value(bit);
+}
+
+//******************************************************************************
+bool sc_map_bool_proxy::event() const
+{
+    return bank->event(bit);
+}
+
+//******************************************************************************
+bool sc_map_bool_proxy::posedge() const
+{
+    return bank->event(bit) && bank->read(bit);
+}
+
+//******************************************************************************
+bool sc_map_bool_proxy::negedge() const
+{
+    return bank->event(bit) && !bank->read(bit);
+}
+
+//******************************************************************************
+void sc_map_bool_proxy::write(const bool& value)
+{
+    bank->write(bit, value);
+
+    return;
+}
+
+//******************************************************************************
+sc_map_bool_proxy::operator const bool&() const
+{
+    return bank->read(bit);
+}
+
+//******************************************************************************
+sc_map_bool_proxy& sc_map_bool_proxy::operator=(const bool& value)
+{
+    bank->write(bit, value);
+
+    return *this;
+}
+
+//******************************************************************************
+sc_map_bool_bank& sc_map_bool_proxy::get_bank() const
+{
+    return *bank;
+}
+
+//******************************************************************************
+void sc_trace(sc_trace_file* tf, const sc_map_bool_proxy& signal,
+        const std::string& name)
+{
+    sc_trace(tf, signal.get_data_ref(), name);
+
+    return;
+}
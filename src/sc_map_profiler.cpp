@@ -0,0 +1,214 @@
+/*!
+ * @file sc_map_profiler.cpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#include "../include/sc_map_profiler.hpp"
+#include "../include/sc_map_json.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+sc_map_profiler elaboration_profile;
+
+//******************************************************************************
+static bool longer_operation(const sc_map_profiler::operation_record& first,
+        const sc_map_profiler::operation_record& second)
+{
+    if (first.total_ns != second.total_ns)
+    {
+        return first.total_ns > second.total_ns;
+    }
+
+    return first.map_name < second.map_name;
+}
+
+//******************************************************************************
+sc_map_profiler::operation_record::operation_record() :
+        call_cnt(0),
+        total_ns(0.0),
+        max_ns(0.0)
+{}
+
+//******************************************************************************
+sc_map_profiler::sc_map_profiler() :
+        start_time(clock_type::now()),
+        last_operation(NULL),
+        last_record(NULL)
+{}
+
+//******************************************************************************
+void sc_map_profiler::record(const char* map_name, const char* operation,
+        const clock_type::time_point& start, const clock_type::time_point& stop,
+        const bool trace)
+{
+    const double duration_ns = std::chrono::duration<double, std::nano>(stop - start).count();
+
+    // operations that run per element repeat the key of the previous call
+    if ((last_record == NULL) || (last_operation != operation) ||
+        (last_map_name != map_name))
+    {
+        record_key_type key(map_name, operation);
+        last_record = &records[key];
+        if (last_record->call_cnt == 0)
+        {
+            last_record->map_name = map_name;
+            last_record->operation = operation;
+        }
+        last_map_name = map_name;
+        last_operation = operation;
+    }
+
+    ++last_record->call_cnt;
+    last_record->total_ns += duration_ns;
+    if (duration_ns > last_record->max_ns)
+    {
+        last_record->max_ns = duration_ns;
+    }
+
+    if (trace)
+    {
+        trace_event event;
+        event.name = map_name;
+        event.operation = operation;
+        event.start_us = std::chrono::duration<double, std::micro>(start - start_time).count();
+        event.duration_us = duration_ns / 1000.0;
+        events.push_back(event);
+    }
+
+    return;
+}
+
+//******************************************************************************
+sc_map_profiler::record_vector_type sc_map_profiler::get_records() const
+{
+    record_vector_type sorted_records;
+    sorted_records.reserve(records.size());
+
+    for (std::map<record_key_type, operation_record>::const_iterator record_it = records.begin();
+         record_it != records.end();
+         ++record_it)
+    {
+        sorted_records.push_back(record_it->second);
+    }
+    std::sort(sorted_records.begin(), sorted_records.end(), longer_operation);
+
+    return sorted_records;
+}
+
+//******************************************************************************
+std::string sc_map_profiler::get_result() const
+{
+    std::stringstream output_string;
+    write_summary(output_string);
+
+    return output_string.str();
+}
+
+//******************************************************************************
+void sc_map_profiler::print_report() const
+{
+    std::cout << get_result();
+
+    return;
+}
+
+//******************************************************************************
+void sc_map_profiler::write_summary(std::ostream& output) const
+{
+    const record_vector_type sorted_records = get_records();
+    const std::ios_base::fmtflags saved_flags = output.flags();
+    const std::streamsize saved_precision = output.precision();
+
+    output << "***************************************" << std::endl;
+    output << std::left << std::setw(40) << "sc_map" << std::setw(16) << "operation"
+           << std::right << std::setw(10) << "calls" << std::setw(14) << "total [ms]"
+           << std::setw(14) << "mean [us]" << std::setw(14) << "max [us]" << std::endl;
+    for (record_vector_type::const_iterator record_it = sorted_records.begin();
+         record_it != sorted_records.end();
+         ++record_it)
+    {
+        output << std::left << std::setw(40) << record_it->map_name
+               << std::setw(16) << record_it->operation
+               << std::right << std::setw(10) << record_it->call_cnt
+               << std::fixed << std::setprecision(3)
+               << std::setw(14) << record_it->total_ns / 1e6
+               << std::setw(14) << record_it->total_ns / 1e3 / record_it->call_cnt
+               << std::setw(14) << record_it->max_ns / 1e3 << std::endl;
+    }
+    output << "***************************************" << std::endl;
+
+    output.flags(saved_flags);
+    output.precision(saved_precision);
+
+    return;
+}
+
+//******************************************************************************
+void sc_map_profiler::write_chrome_trace(std::ostream& output) const
+{
+    const std::ios_base::fmtflags saved_flags = output.flags();
+    const std::streamsize saved_precision = output.precision();
+
+    output << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    for (std::vector<trace_event>::const_iterator event_it = events.begin();
+         event_it != events.end();
+         ++event_it)
+    {
+        output << ((event_it == events.begin()) ? "\n" : ",\n");
+        output << "  {\"name\": ";
+        sc_map_write_json_string(output, event_it->name + " " + event_it->operation);
+        output << ", \"cat\": \"sc_map\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1"
+               << std::fixed << std::setprecision(3)
+               << ", \"ts\": " << event_it->start_us
+               << ", \"dur\": " << event_it->duration_us
+               << ", \"args\": {\"sc_map\": ";
+        sc_map_write_json_string(output, event_it->name);
+        output << ", \"operation\": ";
+        sc_map_write_json_string(output, event_it->operation);
+        output << "}}";
+    }
+    output << "\n]}\n";
+
+    output.flags(saved_flags);
+    output.precision(saved_precision);
+
+    return;
+}
+
+//******************************************************************************
+bool sc_map_profiler::write_chrome_trace(const std::string& file_name) const
+{
+    std::ofstream trace_file(file_name.c_str());
+    if (!trace_file)
+    {
+        std::cerr << "sc_map_profiler: cannot write trace " << file_name << std::endl;
+        return false;
+    }
+
+    write_chrome_trace(trace_file);
+
+    return true;
+}
+
+//******************************************************************************
+sc_map_profiler_report::sc_map_profiler_report(sc_module_name _name,
+        const std::string& trace_file_name) :
+        trace_file_name(trace_file_name)
+{}
+
+//******************************************************************************
+void sc_map_profiler_report::end_of_elaboration()
+{
+    elaboration_profile.print_report();
+    elaboration_profile.write_chrome_trace(trace_file_name);
+
+    return;
+}
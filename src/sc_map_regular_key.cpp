@@ -16,3 +16,29 @@
 //******************************************************************************
 
 const sc_map_regular_key::index_type sc_map_regular_key::default_start_id = 0;
+
+//******************************************************************************
+void sc_map_regular_key::append_index(std::string& buffer,
+        const index_type index)
+{
+    char digits[3 * sizeof(index_type) + 1];
+    char* digit_it = digits + sizeof(digits);
+
+    unsigned long value = (index < 0) ? (0ul - static_cast<unsigned long>(index)) : index;
+    do
+    {
+        --digit_it;
+        *digit_it = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    if (index < 0)
+    {
+        --digit_it;
+        *digit_it = '-';
+    }
+
+    buffer.append(digit_it, digits + sizeof(digits));
+
+    return;
+}
@@ -25,50 +25,45 @@ sc_map_square_key::sc_map_square_key(const index_type& Y, const index_type& X) :
         X(X)
 {}
 
+//******************************************************************************
+sc_map_square_key::sc_map_square_key(const packed_type& packed_key) :
+        Y(packed_key.get(0)),
+        X(packed_key.get(1))
+{}
+
 //******************************************************************************
 std::string sc_map_square_key::get_string() const
 {
-    std::stringstream collection_stream;
-    collection_stream << Y;
-    collection_stream << sc_map::key_sub_separator_char;
-    collection_stream << X;
+    std::string key_string;
+    append_string(key_string);
 
-    return collection_stream.str();
+    return key_string;
 }
 
 //******************************************************************************
-bool sc_map_square_key::operator==(const sc_map_key& other_key) const
+void sc_map_square_key::append_string(std::string& buffer) const
 {
-    const sc_map_square_key* other_key_square =
-            dynamic_cast<const sc_map_square_key*>(&other_key);
+    append_index(buffer, Y);
+    buffer += sc_map::key_sub_separator_char;
+    append_index(buffer, X);
 
-    bool equal = true;
+    return;
+}
 
-    equal &= this->Y == other_key_square->Y;
-    equal &= this->X == other_key_square->X;
+//******************************************************************************
+sc_map_square_key::packed_type sc_map_square_key::packed() const
+{
+    return packed_type(Y, X);
+}
 
-    return equal;
+//******************************************************************************
+bool sc_map_square_key::operator==(const sc_map_key& other_key) const
+{
+    return (*this == dynamic_cast<const sc_map_square_key&>(other_key));
 }
 
 //******************************************************************************
 bool sc_map_square_key::operator<(const sc_map_key& other_key) const
 {
-    const sc_map_square_key* other_key_square =
-            dynamic_cast<const sc_map_square_key*>(&other_key);
-
-    bool smaller = false;
-
-    if (this->Y < other_key_square->Y)
-    {
-        smaller = true;
-    }
-    else if (this->Y == other_key_square->Y)
-    {
-        if (this->X < other_key_square->X)
-        {
-            smaller = true;
-        }
-    }
-
-    return smaller;
+    return (*this < dynamic_cast<const sc_map_square_key&>(other_key));
 }
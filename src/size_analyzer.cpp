@@ -0,0 +1,269 @@
+/*!
+ * @file size_analyzer.cpp
+ * @author Christian Amstutz
+ * @date October 16, 2026
+ */
+
+/*
+ *  Copyright (c) 2026 by Christian Amstutz
+ */
+
+#include "../include/size_analyzer.hpp"
+#include "../include/sc_map_json.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+size_analyzer simulation_size;
+
+//******************************************************************************
+static bool larger_map(const size_analyzer::map_record& first,
+        const size_analyzer::map_record& second)
+{
+    if (first.total_bytes() != second.total_bytes())
+    {
+        return first.total_bytes() > second.total_bytes();
+    }
+
+    return first.name < second.name;
+}
+
+//******************************************************************************
+size_analyzer::map_record::map_record() :
+        element_cnt(0),
+        element_bytes(0),
+        storage_bytes(0),
+        range_bytes(0),
+        iterator_cnt(0),
+        iterator_bytes(0)
+{}
+
+//******************************************************************************
+std::size_t size_analyzer::map_record::total_bytes() const
+{
+    return element_bytes + storage_bytes + range_bytes;
+}
+
+//******************************************************************************
+size_analyzer::size_analyzer()
+{}
+
+//******************************************************************************
+void size_analyzer::add_sc_map(const void* sc_map, const map_record& record)
+{
+    records[sc_map] = record;
+
+    return;
+}
+
+//******************************************************************************
+void size_analyzer::remove_sc_map(const void* sc_map)
+{
+    records.erase(sc_map);
+
+    return;
+}
+
+//******************************************************************************
+void size_analyzer::add_iterator(const void* sc_map, const std::size_t heap_bytes)
+{
+    std::map<const void*, map_record>::iterator record_it = records.find(sc_map);
+    if (record_it != records.end())
+    {
+        ++record_it->second.iterator_cnt;
+        record_it->second.iterator_bytes += heap_bytes;
+    }
+
+    return;
+}
+
+//******************************************************************************
+const char* size_analyzer::kind_of(const sc_object* element)
+{
+    return element->kind();
+}
+
+//******************************************************************************
+const char* size_analyzer::kind_of(const void* element)
+{
+    return "";
+}
+
+//******************************************************************************
+size_analyzer::record_vector_type size_analyzer::get_records() const
+{
+    record_vector_type sorted_records;
+    sorted_records.reserve(records.size());
+
+    for (std::map<const void*, map_record>::const_iterator record_it = records.begin();
+         record_it != records.end();
+         ++record_it)
+    {
+        sorted_records.push_back(record_it->second);
+    }
+    std::sort(sorted_records.begin(), sorted_records.end(), larger_map);
+
+    return sorted_records;
+}
+
+//******************************************************************************
+size_analyzer::map_record size_analyzer::get_total() const
+{
+    map_record total;
+    total.name = "total";
+
+    for (std::map<const void*, map_record>::const_iterator record_it = records.begin();
+         record_it != records.end();
+         ++record_it)
+    {
+        total.element_cnt += record_it->second.element_cnt;
+        total.element_bytes += record_it->second.element_bytes;
+        total.storage_bytes += record_it->second.storage_bytes;
+        total.range_bytes += record_it->second.range_bytes;
+        total.iterator_cnt += record_it->second.iterator_cnt;
+        total.iterator_bytes += record_it->second.iterator_bytes;
+    }
+
+    return total;
+}
+
+//******************************************************************************
+std::string size_analyzer::get_result() const
+{
+    std::stringstream output_string;
+    const record_vector_type sorted_records = get_records();
+    const map_record total = get_total();
+
+    output_string << "***************************************" << std::endl;
+    output_string << sorted_records.size() << " sc_map objects with "
+                  << total.element_cnt << " elements, "
+                  << total.total_bytes() << " bytes" << std::endl;
+    for (record_vector_type::const_iterator record_it = sorted_records.begin();
+         record_it != sorted_records.end();
+         ++record_it)
+    {
+        output_string << "  " << record_it->name << " (" << record_it->kind
+                      << "): " << record_it->element_cnt << " elements, "
+                      << record_it->total_bytes() << " bytes ("
+                      << record_it->element_bytes << " elements, "
+                      << record_it->storage_bytes << " storage, "
+                      << record_it->range_bytes << " range), "
+                      << record_it->iterator_cnt << " iterators" << std::endl;
+    }
+    output_string << "***************************************" << std::endl;
+
+    return output_string.str();
+}
+
+//******************************************************************************
+void size_analyzer::print_report() const
+{
+    std::cout << get_result();
+
+    return;
+}
+
+//******************************************************************************
+void size_analyzer::write_json(std::ostream& output) const
+{
+    const record_vector_type sorted_records = get_records();
+    const map_record total = get_total();
+
+    output << "{\n  \"maps\": [";
+    for (record_vector_type::const_iterator record_it = sorted_records.begin();
+         record_it != sorted_records.end();
+         ++record_it)
+    {
+        output << ((record_it == sorted_records.begin()) ? "\n" : ",\n");
+        output << "    {\"name\": ";
+        sc_map_write_json_string(output, record_it->name);
+        output << ", \"kind\": ";
+        sc_map_write_json_string(output, record_it->kind);
+        output << ", \"element_kind\": ";
+        sc_map_write_json_string(output, record_it->element_kind);
+        output << ", \"elements\": " << record_it->element_cnt
+               << ", \"element_bytes\": " << record_it->element_bytes
+               << ", \"storage_bytes\": " << record_it->storage_bytes
+               << ", \"range_bytes\": " << record_it->range_bytes
+               << ", \"total_bytes\": " << record_it->total_bytes()
+               << ", \"iterators\": " << record_it->iterator_cnt
+               << ", \"iterator_bytes\": " << record_it->iterator_bytes << "}";
+    }
+    output << "\n  ],\n";
+    output << "  \"total\": {\"maps\": " << sorted_records.size()
+           << ", \"elements\": " << total.element_cnt
+           << ", \"element_bytes\": " << total.element_bytes
+           << ", \"storage_bytes\": " << total.storage_bytes
+           << ", \"range_bytes\": " << total.range_bytes
+           << ", \"total_bytes\": " << total.total_bytes()
+           << ", \"iterators\": " << total.iterator_cnt
+           << ", \"iterator_bytes\": " << total.iterator_bytes << "}\n";
+    output << "}\n";
+
+    return;
+}
+
+//******************************************************************************
+void size_analyzer::write_csv(std::ostream& output) const
+{
+    const record_vector_type sorted_records = get_records();
+
+    output << "name,kind,element_kind,elements,element_bytes,storage_bytes,"
+           << "range_bytes,total_bytes,iterators,iterator_bytes\n";
+    for (record_vector_type::const_iterator record_it = sorted_records.begin();
+         record_it != sorted_records.end();
+         ++record_it)
+    {
+        output << record_it->name << ","
+               << record_it->kind << ","
+               << record_it->element_kind << ","
+               << record_it->element_cnt << ","
+               << record_it->element_bytes << ","
+               << record_it->storage_bytes << ","
+               << record_it->range_bytes << ","
+               << record_it->total_bytes() << ","
+               << record_it->iterator_cnt << ","
+               << record_it->iterator_bytes << "\n";
+    }
+
+    return;
+}
+
+//******************************************************************************
+bool size_analyzer::write_report(const std::string& file_name) const
+{
+    std::ofstream report_file(file_name.c_str());
+    if (!report_file)
+    {
+        std::cerr << "size_analyzer: cannot write report " << file_name << std::endl;
+        return false;
+    }
+
+    const std::string csv_extension = ".csv";
+    if ((file_name.size() >= csv_extension.size()) &&
+        (file_name.compare(file_name.size() - csv_extension.size(), csv_extension.size(), csv_extension) == 0))
+    {
+        write_csv(report_file);
+    }
+    else
+    {
+        write_json(report_file);
+    }
+
+    return true;
+}
+
+//******************************************************************************
+size_analyzer_report::size_analyzer_report(sc_module_name _name,
+        const std::string& file_name) :
+        file_name(file_name)
+{}
+
+//******************************************************************************
+void size_analyzer_report::end_of_elaboration()
+{
+    simulation_size.write_report(file_name);
+
+    return;
+}
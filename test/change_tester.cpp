@@ -0,0 +1,37 @@
+#include "change_tester.hpp"
+
+//******************************************************************************
+change_tester::change_tester(sc_module_name _name) :
+        sc_module(_name),
+        signals(8, "signal")
+{
+    // Spawns the processes of the change monitor during elaboration
+    signals.changed_event();
+
+    SC_THREAD(change_signals);
+
+    return;
+}
+
+//******************************************************************************
+void change_tester::change_signals()
+{
+    wait(10, SC_NS);
+
+    signals.at(2).write(true);
+    signals.at(5).write(true);
+
+    // The signal written in the following delta cycle is recorded while the
+    // keys of the first two signals are published.
+    wait(SC_ZERO_TIME);
+
+    signals.at(7).write(true);
+
+    wait(signals.changed_event());
+    first_changed_keys = signals.changed_keys();
+
+    wait(signals.changed_event());
+    second_changed_keys = signals.changed_keys();
+
+    return;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <systemc.h>
+
+#include "../include/sc_map.hpp"
+
+class change_tester : public sc_module
+{
+public:
+    sc_map_linear<sc_signal<bool> > signals;
+
+    sc_map_linear<sc_signal<bool> >::key_vector_type first_changed_keys;
+    sc_map_linear<sc_signal<bool> >::key_vector_type second_changed_keys;
+
+    void change_signals();
+
+    change_tester(sc_module_name _name);
+    SC_HAS_PROCESS(change_tester);
+};
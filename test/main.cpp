@@ -2,11 +2,61 @@
 //#include "../sc_analyzer/include/sc_analyzer.hpp"
 #include "source.hpp"
 #include "sink.hpp"
+#include "change_tester.hpp"
 //#include "bind_tester.hpp"
 
 #include <systemc.h>
 
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <type_traits>
+
+// Number of failed checks, sc_main returns 1 if there is any
+static unsigned int failed_check_cnt = 0;
+
+//******************************************************************************
+void check(const std::string& description, const bool passed)
+{
+    if (passed)
+    {
+        std::cout << "passed: " << description << std::endl;
+    }
+    else
+    {
+        std::cout << "FAILED: " << description << std::endl;
+        ++failed_check_cnt;
+    }
+
+    return;
+}
+
+//******************************************************************************
+//******************************************************************************
+// Key filter for sc_trace_if() that accepts a row and counts the accepted keys
+class row_filter
+{
+public:
+    row_filter(const int row, std::size_t* accepted_cnt) :
+            row(row),
+            accepted_cnt(accepted_cnt)
+    {}
+
+    bool operator()(const sc_map_square_key& key) const
+    {
+        if (key.Y != row)
+        {
+            return false;
+        }
+        ++(*accepted_cnt);
+
+        return true;
+    }
+
+private:
+    int row;
+    std::size_t* accepted_cnt;
+};
 
 int sc_main(int argc, char *agv[])
 {
@@ -33,6 +83,8 @@ int sc_main(int argc, char *agv[])
 
     sc_map_cube<sc_signal<bool> > signals3(4, 3, 2, "signal3");
     sc_map_4d<sc_signal<bool> > signals4(5, 4, 3, 2, "signal4");
+    sc_map_nd<5, sc_signal<bool> > signals5(sc_map_nd_key<5>(0, 0, 0, 0, 0),
+            sc_map_nd_key<5>(1, 1, 1, 1, 1), "signal5");
 
 //    std::cout << "Signals in signals1: " << signals1.size() << std::endl;
 //    std::cout << "Signals in signals2: " << signals2.size() << " ("
@@ -177,6 +229,267 @@ int sc_main(int argc, char *agv[])
     test_config_sink_linear2[0].input.bind(signal_config[0]);
     test_config_sink_linear2[1].input.bind(signal_config[1]);
 
+    // Testing dense storage
+    check("dense storage places the objects in key order",
+            &signals_sq.at(sc_map_square_key(1, 0)) == &signals_sq.at(sc_map_square_key(0, 0)) + 3);
+    bool missing_key_rejected = false;
+    try
+    {
+        signals1.at(sc_map_linear_key(2));
+    }
+    catch (...)
+    {
+        missing_key_rejected = true;
+    }
+    check("at() rejects a key without object", missing_key_rejected);
+
+    // Testing packed keys
+    sc_map_square<sc_signal<bool> >::key_type packed_key = sc_map_square_key(2, 1);
+    check("named keys convert to the packed keys of the container",
+            (packed_key[0] == 2) && (packed_key[1] == 1));
+    sc_map_square_key named_key = signals_sq.get_key(signals_sq.at(2, 1)).second;
+    check("keys of the container convert to named keys",
+            (named_key.Y == 2) && (named_key.X == 1));
+    check("packed keys are ordered like the named keys",
+            (sc_map_4d<sc_signal<bool> >::key_type(sc_map_4d_key(0, 3, 2, 1)) < sc_map_4d_key(1, 0, 0, 0))
+            && !(sc_map_cube<sc_signal<bool> >::key_type(sc_map_cube_key(1, 0, 0)) < sc_map_cube_key(0, 2, 2)));
+    check("packed keys are trivially copyable",
+            std::is_trivially_copyable<sc_map_4d<sc_signal<bool> >::key_type>::value);
+
+    // Testing N-dimensional containers
+    std::size_t nd_cnt = 0;
+    for (sc_map_nd<5, sc_signal<bool> >::iterator nd_it = signals5.begin();
+         nd_it != signals5.end();
+         ++nd_it)
+    {
+        ++nd_cnt;
+    }
+    check("sc_map_nd contains all elements", nd_cnt == 32);
+    check("sc_map_nd at() with indexes",
+            &signals5.at(1, 0, 1, 0, 1) == &signals5.at(sc_map_nd_key<5>(1, 0, 1, 0, 1)));
+    check("sc_map_nd names", std::string(signals5.at(1, 0, 1, 0, 1).basename()) == "signal5_1-0-1-0-1");
+    check("sc_map_nd neighbor", (signals5.neighbor(sc_map_nd_key<5>(0, 0, 0, 0, 1), sc_map_nd_key<5>(0, 0, 0, 0, 1)) == NULL)
+            && (signals5.neighbor(sc_map_nd_key<5>(0, 0, 0, 0, 1), sc_map_nd_key<5>(0, 0, 0, 0, 1), true) == &signals5.at(0, 0, 0, 0, 0)));
+
+    // Testing list ranges
+    std::vector<char> unsorted_keys;
+    unsorted_keys.push_back('c');
+    unsorted_keys.push_back('a');
+    unsorted_keys.push_back('b');
+    unsorted_keys.push_back('a');
+    sc_map_list_range<char> unsorted_range(unsorted_keys);
+    sc_map_list_key<char> list_key = unsorted_range.first();
+    bool list_order_kept = (unsorted_range.size() == 3) && (list_key == sc_map_list_key<char>('c'));
+    list_order_kept = list_order_kept && unsorted_range.next_key(list_key) && (list_key == sc_map_list_key<char>('a'));
+    list_order_kept = list_order_kept && unsorted_range.next_key(list_key) && (list_key == sc_map_list_key<char>('b'));
+    check("list range steps through its keys in the order they were added",
+            list_order_kept && !unsorted_range.next_key(list_key));
+
+    // Testing the binding of list containers
+    std::vector<char> list_port_names;
+    list_port_names.push_back('c');
+    list_port_names.push_back('b');
+    list_port_names.push_back('a');
+    sc_map_list<char, sc_in<bool> > list_ports(list_port_names, "list_port");
+    sc_map_list<char, sc_in<bool> >::key_vector_type unbound_list_ports = list_ports.bind(signals_list);
+    check("list bind returns the ports without signal",
+            (unbound_list_ports.size() == 1) && (unbound_list_ports[0] == sc_map_list_key<char>('c')));
+    sc_signal<bool> list_boundary("list_boundary");
+    list_ports.at(sc_map_list_key<char>('c')).bind(list_boundary);
+
+    // Testing the reverse index of get_keys()
+    std::vector<sc_signal<bool>*> key_objects;
+    key_objects.push_back(&signals2.at(2, 1));
+    key_objects.push_back(&test_signal);
+    key_objects.push_back(&signals2.at(0, 0));
+    std::vector<std::pair<bool, sc_map_square<sc_signal<bool> >::key_type> > object_keys = signals2.get_keys(key_objects);
+    check("get_keys() finds the keys of the objects of the container",
+            object_keys[0].first && (object_keys[0].second == sc_map_square_key(2, 1))
+            && object_keys[2].first && (object_keys[2].second == sc_map_square_key(0, 0)));
+    check("get_keys() rejects other objects", !object_keys[1].first);
+
+    // Testing in-place construction
+    check("objects of a list container are constructed in one arena",
+            &signals_list.at(sc_map_list_key<char>('b')) == &signals_list.at(sc_map_list_key<char>('a')) + 1);
+
+    // Testing the generated names
+    check("names of the elements are built from the keys",
+            (std::string(signals_sq.at(3, 2).basename()) == "signalSQ_3-2")
+            && (std::string(signals3.at(3, 2, 1).basename()) == "signal3_3-2-1"));
+
+    // Testing regular ranges
+    sc_map_linear_range linear_range(sc_map_linear_key(9), sc_map_linear_key(0));
+    check("size and key_in_range() of a linear range", (linear_range.size() == 10)
+            && linear_range.key_in_range(sc_map_linear_key(0)) && !linear_range.key_in_range(sc_map_linear_key(10)));
+    sc_map_square_range square_range(sc_map_square_key(3, 0), sc_map_square_key(0, 2));
+    check("size and key_in_range() of a square range", (square_range.size() == 12)
+            && square_range.key_in_range(sc_map_square_key(3, 2)) && !square_range.key_in_range(sc_map_square_key(4, 0)));
+    bool outside_sub_range_rejected = false;
+    try
+    {
+        signals1.view(sc_map_linear_key(0), sc_map_linear_key(2));
+    }
+    catch (...)
+    {
+        outside_sub_range_rejected = true;
+    }
+    check("linear sub-ranges outside of the container are rejected", outside_sub_range_rejected);
+
+    // Testing the change monitor, its thread changes the signals at 10 ns
+    change_tester changes("changes");
+    check("changed_keys() is empty during elaboration",
+            changes.signals.changed_keys().empty()
+            && (&changes.signals.changed_event() == &changes.signals.changed_event()));
+
+    // Testing packed bool signals
+    sc_map_packed_bool<sc_map_linear_range> packed(sc_map_linear_range(0, 39), "packed");
+    sc_bv<40> packed_bits;
+    packed_bits.set_word(0, 0xffffffff);
+    packed.read_bits(packed_bits);
+    check("packed bools start with false", packed_bits.get_word(0) == 0);
+    const sc_event& packed_changed = packed.changed_event();
+    check("change monitor on packed bools", packed.changed_keys().empty()
+            && (&packed_changed == &packed.changed_event()));
+
+    // Testing containers with a fixed shape
+    // An index outside of the shape, e.g. fixed_signals.at<3, 0>(), is
+    // rejected at compile time by the static_assert of at<>().
+    sc_map_fixed<sc_signal<bool>, 3, 4> fixed_signals("fixed_signal");
+    check("compile-time at<>() and runtime at() return the same object",
+            (&fixed_signals.at<1, 2>() == &fixed_signals.at(1, 2))
+            && (&fixed_signals.at<2, 3>() == &fixed_signals.at(sc_map_nd_key<2>(2, 3))));
+    std::size_t fixed_cnt = 0;
+    bool fixed_keys_match = true;
+    for (sc_map_fixed<sc_signal<bool>, 3, 4>::iterator fixed_it = fixed_signals.begin();
+         fixed_it != fixed_signals.end();
+         ++fixed_it)
+    {
+        std::pair<bool, sc_map_fixed<sc_signal<bool>, 3, 4>::key_type> fixed_key = fixed_it.get_key();
+        fixed_keys_match = fixed_keys_match && !fixed_key.first
+                && (&fixed_signals.at(fixed_key.second) == &(*fixed_it));
+        ++fixed_cnt;
+    }
+    check("iteration visits all elements of a fixed shape", fixed_cnt == 12);
+    check("get_key() of the iterator returns the key of the element", fixed_keys_match);
+
+    // Testing views
+    sc_map_view<sc_map_square_range, sc_signal<bool> > square_view =
+            signals_sq.view(sc_map_square_key(1, 0), sc_map_square_key(2, 1));
+    check("view size", square_view.size() == 4);
+    check("view contains keys of its range", square_view.contains(sc_map_square_key(2, 1))
+            && !square_view.contains(sc_map_square_key(0, 0)));
+    check("view at() returns the object of the container",
+            &square_view.at(sc_map_square_key(2, 0)) == &signals_sq.at(sc_map_square_key(2, 0)));
+    sc_map_view<sc_map_square_range, sc_signal<bool> > nested_view =
+            square_view(sc_map_square_key(2, 0), sc_map_square_key(2, 1));
+    check("nested view size", nested_view.size() == 2);
+    std::size_t view_cnt = 0;
+    for (sc_map_view<sc_map_square_range, sc_signal<bool> >::iterator view_it = square_view.begin();
+         view_it != square_view.end();
+         ++view_it)
+    {
+        ++view_cnt;
+    }
+    check("view iteration", view_cnt == 4);
+
+    // Testing pattern ranges
+    sc_map_linear<sc_signal<bool> > lanes(16, "lanes");
+    std::size_t lane_cnt = 0;
+    for (sc_map_iterator<sc_map_base<sc_map_linear_range, sc_signal<bool> >, sc_map_strided_range<1, sc_map_linear_key> > lane_it =
+                 lanes.begin(sc_map_strided_range<1, sc_map_linear_key>(sc_map_linear_key(0), sc_map_linear_key(15), 4));
+         lane_it != lanes.end();
+         ++lane_it)
+    {
+        ++lane_cnt;
+    }
+    check("strided range visits every 4th lane", lane_cnt == 4);
+    sc_map_checkerboard_range<2> black(sc_map_square_key(0, 0), sc_map_square_key(2, 2), 0);
+    sc_map_checkerboard_range<2> white(sc_map_square_key(0, 0), sc_map_square_key(2, 2), 1);
+    check("checkerboard sizes", (black.size() == 5) && (white.size() == 4)
+            && !white.key_in_range(sc_map_square_key(1, 1)));
+    check("checkerboard key_at() follows the traversal", (white.key_at(2) == sc_map_square_key(1, 2))
+            && (black.last() == sc_map_square_key(2, 2)));
+    sc_map_checkerboard_range<2> no_white(sc_map_square_key(1, 1), sc_map_square_key(1, 1), 1);
+    check("empty checkerboard", no_white.empty() && (signals_sq.begin(no_white) == signals_sq.end()));
+    sc_map_tiled_range<2> tiles(sc_map_square_key(0, 0), sc_map_square_key(3, 2), 2);
+    std::size_t tile_index;
+    check("tiled key_at() follows the traversal", (tiles.key_at(2) == sc_map_square_key(1, 0))
+            && tiles.index_of(sc_map_square_key(0, 2), tile_index) && (tile_index == 4));
+
+    // Testing shift binding
+    sc_map_square<sc_in<bool> > shift_ports(3, 3, "shift_ports");
+    sc_map_square<sc_signal<bool> > shift_signals(3, 3, "shift_signals");
+    sc_signal<bool> shift_boundary("shift_boundary");
+    sc_map_square<sc_in<bool> >::key_vector_type unbound_ports = shift_ports.shift(0, +1).bind(shift_signals);
+    check("shift leaves the eastern border unbound", (unbound_ports.size() == 3)
+            && (unbound_ports[0] == sc_map_square_key(0, 2)));
+    check("shift binds a port to the signal of its neighbor",
+            shift_ports.at(sc_map_square_key(1, 0)).operator->() == &shift_signals.at(sc_map_square_key(1, 1)));
+    for (sc_map_square<sc_in<bool> >::key_vector_type::const_iterator key_it = unbound_ports.begin();
+         key_it != unbound_ports.end();
+         ++key_it)
+    {
+        shift_ports.at(*key_it).bind(shift_boundary);
+    }
+    sc_map_square<sc_in<bool> > torus_ports(3, 3, "torus_ports");
+    check("wrapped shift binds all ports", torus_ports.shift(+1, 0).wrap().bind(shift_signals).empty());
+
+    // Testing set operations of list ranges
+    std::vector<char> keys_a;
+    keys_a.push_back('a');
+    keys_a.push_back('b');
+    keys_a.push_back('c');
+    std::vector<char> keys_b;
+    keys_b.push_back('b');
+    keys_b.push_back('c');
+    keys_b.push_back('d');
+    sc_map_list_range<char> list_a(keys_a);
+    sc_map_list_range<char> list_b(keys_b);
+    check("list merge", (list_a.merge(list_b).size() == 4)
+            && (list_a.merge(list_b).last() == sc_map_list_key<char>('d')));
+    check("list intersection", (list_a.intersection(list_b).size() == 2)
+            && (list_a.intersection(list_b).first() == sc_map_list_key<char>('b')));
+    check("list difference", (list_a.difference(list_b).size() == 1)
+            && list_a.difference(list_b).key_in_range(sc_map_list_key<char>('a')));
+    check("empty list intersection", list_a.difference(list_b).intersection(list_b).empty());
+
+#ifdef SC_MAP_PROFILER
+    // Testing the elaboration profiler
+    sc_map_profiler::record_vector_type profile_records = elaboration_profile.get_records();
+    bool init_recorded = false;
+    for (sc_map_profiler::record_vector_type::const_iterator record_it = profile_records.begin();
+         record_it != profile_records.end();
+         ++record_it)
+    {
+        if ((record_it->map_name == "signal1") && (record_it->operation == "init"))
+        {
+            init_recorded = (record_it->call_cnt == 1);
+        }
+    }
+    check("profiler records init()", init_recorded);
+#endif
+
+#ifdef SC_MAP_SIZE_ANALYZER
+    // Testing the size analyzer
+    size_analyzer::record_vector_type size_records = simulation_size.get_records();
+    bool size_recorded = false;
+    for (size_analyzer::record_vector_type::const_iterator record_it = size_records.begin();
+         record_it != size_records.end();
+         ++record_it)
+    {
+        if (record_it->name == "signal2")
+        {
+            size_recorded = (record_it->element_cnt == 6)
+                    && (record_it->element_bytes == 6 * sizeof(sc_signal<bool>));
+        }
+    }
+    check("size analyzer records signal2", size_recorded);
+#endif
+
+    // Containers for the bulk writes and reads after the simulation
+    sc_map_linear<sc_signal<int> > bulk_signals(4, "bulk");
+    sc_map_linear<sc_signal<bool> > bulk_bools(6, "bulk_bool");
+
     // **** Setup Tracing
     sc_trace_file* fp;
     fp=sc_create_vcd_trace_file("wave");
@@ -188,6 +501,18 @@ int sc_main(int argc, char *agv[])
     sc_trace(fp, signals4, "signal4");
     //sc_trace(fp, bind_signals, "b_signal");
 
+    // Testing selective and sampled traces
+    std::size_t traced_cnt = 0;
+    sc_trace_if(fp, signals2, "signal2_row", row_filter(1, &traced_cnt));
+    check("selective trace of a row", traced_cnt == 2);
+    sc_trace_sampled(fp, lanes, "lanes", 4);
+    // A zero interval is reported with a warning and nothing is traced
+    sc_trace_sampled(fp, lanes, "lanes_none", 0);
+
+    // Testing bus traces
+    sc_trace_bus(fp, packed, "packed_bus");
+    sc_map_bus_trace<sc_map_base<sc_map_linear_range, sc_signal<bool> > > bulk_bus(bulk_bools);
+
     std::cout << "\n--- Simulation starts ---\n" << std::endl;
 
 //    myAnalyzer.register_model_setup_end();
@@ -199,9 +524,72 @@ int sc_main(int argc, char *agv[])
 
     std::cout << "\n--- Simulation ended ---\n" << std::endl;
 
+    check("list bind connects the ports to the signals with the same key",
+            (list_ports.at(sc_map_list_key<char>('a')).operator->() == &signals_list.at(sc_map_list_key<char>('a')))
+            && (list_ports.at(sc_map_list_key<char>('b')).operator->() == &signals_list.at(sc_map_list_key<char>('b'))));
+
+    sc_map_linear<sc_signal<bool> >::key_vector_type& first_keys = changes.first_changed_keys;
+    check("changed_keys() returns the two signals changed in one delta cycle",
+            (first_keys.size() == 2)
+            && (std::find(first_keys.begin(), first_keys.end(), sc_map_linear_key(2)) != first_keys.end())
+            && (std::find(first_keys.begin(), first_keys.end(), sc_map_linear_key(5)) != first_keys.end()));
+    check("changed_keys() returns the signal changed in the following delta cycle",
+            (changes.second_changed_keys.size() == 1)
+            && (changes.second_changed_keys[0] == sc_map_linear_key(7)));
+
+    // Testing packed bool signals during simulation
+    sc_bv<40> written_bits;
+    written_bits.set_word(0, 0x80000001);
+    written_bits.set_word(1, 0x81);
+    packed.write_bits(written_bits);
+    sc_start(SC_ZERO_TIME);
+    sc_map_base<sc_map_linear_range, sc_map_bool_proxy>& packed_base = packed;
+    sc_bv<40> read_bits;
+    packed_base.read_bits(read_bits);
+    check("packed bools read back through the base class", read_bits.to_string() == written_bits.to_string());
+    check("packed bool elements", packed.at(sc_map_linear_key(31)).read()
+            && packed.at(sc_map_linear_key(39)).read() && !packed.at(sc_map_linear_key(38)).read());
+
+    // Testing bulk writes
+    std::vector<int> bulk_values;
+    bulk_values.push_back(4);
+    bulk_values.push_back(-3);
+    bulk_values.push_back(2);
+    bulk_values.push_back(-1);
+    bulk_signals.write_all(bulk_values);
+    sc_bv<6> written_bools;
+    written_bools.set_word(0, 0x25);
+    bulk_bools.write_bits(written_bools);
+    sc_start(SC_ZERO_TIME);
+    check("write_all() writes the values in the order of the range",
+            (bulk_signals.at(0).read() == 4) && (bulk_signals.at(1).read() == -3)
+            && (bulk_signals.at(3).read() == -1));
+    check("write_bits() writes bit 0 to the first signal",
+            bulk_bools.at(0).read() && !bulk_bools.at(1).read() && bulk_bools.at(2).read()
+            && bulk_bools.at(5).read());
+
+    // Testing bulk reads
+    std::vector<int> read_values;
+    bulk_signals.read_all(read_values);
+    check("read_all() returns the values in the order of the range", read_values == bulk_values);
+    sc_bv<6> read_bools;
+    bulk_bools.read_bits(read_bools);
+    check("read_bits() packs the first signal into bit 0", read_bools.get_word(0) == 0x25);
+
+    // Testing the bus trace, which packs the signals one delta cycle after
+    // they changed
+    sc_start(SC_ZERO_TIME);
+    check("bus trace packs the first signal into bit 0", bulk_bus.get_bits().get_word(0) == 0x25);
+
     sc_close_vcd_trace_file(fp);
 
 //    myAnalyzer.print_report();
 
+    if (failed_check_cnt != 0)
+    {
+        std::cout << failed_check_cnt << " checks failed" << std::endl;
+        return(1);
+    }
+
     return(0);
 }